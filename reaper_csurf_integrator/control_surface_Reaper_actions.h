@@ -98,7 +98,7 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(DAW::GetLastTouchedFX(&trackNum_, &fxSlotNum_, &fxParamNum_))
+        if(context->GetPage()->GetLastTouchedFX(trackNum_, fxSlotNum_, fxParamNum_))
             if(DAW::GetTrack(trackNum_))
                 context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
     }
@@ -255,8 +255,12 @@ public:
 class TrackVolume : public Action
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 {
+private:
+    vector<double> normalizedVolumes_; // scratch for RequestBatchUpdate, keeps its capacity between cycles
+    
 public:
     virtual string GetName() override { return "TrackVolume"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
     
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -272,12 +276,41 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+            context->UpdateWidgetValue(volToNormalized(context->GetPage()->GetTrackState(track).GetVolume()));
         else
             context->ClearWidget();
     }
     
+    // A batch comes from one surface, so one Page serves it, and the volumes are gathered and converted in one pass before any feedback goes out
+    virtual void RequestBatchUpdate(vector<ActionContext*> &contexts) override
+    {
+        if(contexts.size() == 0)
+            return;
+        
+        Page* page = contexts[0]->GetPage();
+        
+        normalizedVolumes_.resize(contexts.size());
+        
+        for(int i = 0; i < (int)contexts.size(); i++)
+        {
+            MediaTrack* track = contexts[i]->GetTrack();
+            normalizedVolumes_[i] = track != nullptr ? page->GetTrackState(track).GetVolume() : -1.0; // a volume is never negative
+        }
+        
+        for(auto &volume : normalizedVolumes_)
+            if(volume >= 0.0)
+                volume = volToNormalized(volume);
+        
+        for(int i = 0; i < (int)contexts.size(); i++)
+        {
+            if(normalizedVolumes_[i] >= 0.0)
+                contexts[i]->UpdateWidgetValue(normalizedVolumes_[i]);
+            else
+                contexts[i]->ClearWidget();
+        }
+    }
+    
     virtual void Do(ActionContext* context, double value) override
     {
         if(MediaTrack* track = context->GetTrack())
@@ -391,6 +424,7 @@ class TrackPan : public Action
 {
 public:
     virtual string GetName() override { return "TrackPan"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
     
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -409,8 +443,15 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+        {
+            TrackState &state = context->GetPage()->GetTrackState(track);
+            
+            if(state.GetPanMode() != 6)
+                context->UpdateWidgetValue(panToNormalized(state.GetPan()));
+            else
+                context->UpdateWidgetValue(0.0);
+        }
         else
             context->ClearWidget();
     }
@@ -485,6 +526,7 @@ class TrackPanWidth : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanWidth"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
 
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -498,8 +540,8 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            if(GetPanMode(track) != 6)
-                context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+            if(context->GetPage()->GetTrackState(track).GetPanMode() != 6)
+                context->UpdateWidgetValue(panToNormalized(context->GetPage()->GetTrackState(track).GetWidth()));
         }
         else
             context->ClearWidget();
@@ -563,6 +605,7 @@ class TrackPanL : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanL"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
     
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -576,8 +619,8 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            if(GetPanMode(track) == 6)
-                context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+            if(context->GetPage()->GetTrackState(track).GetPanMode() == 6)
+                context->UpdateWidgetValue(panToNormalized(context->GetPage()->GetTrackState(track).GetDualPanL()));
         }
         else
             context->ClearWidget();
@@ -651,6 +694,7 @@ class TrackPanR : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanR"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
     
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -664,8 +708,8 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            if(GetPanMode(track) == 6)
-                context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+            if(context->GetPage()->GetTrackState(track).GetPanMode() == 6)
+                context->UpdateWidgetValue(panToNormalized(context->GetPage()->GetTrackState(track).GetDualPanR()));
         }
         else
             context->ClearWidget();
@@ -873,7 +917,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetSlotIndex() + numHardwareSends, &vol, &pan);
             return volToNormalized(vol);
@@ -884,7 +928,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetSlotIndex() < context->GetPage()->GetNumSends(track))
             context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
         else
             context->ClearWidget();
@@ -894,7 +940,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             DAW::SetTrackSendUIVol(track, context->GetSlotIndex() + numHardwareSends, normalizedToVol(value), 0);
         }
     }
@@ -903,7 +949,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetSlotIndex() + numHardwareSends, &vol, &pan);
             
@@ -924,9 +970,11 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(MediaTrack* track = context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetParamIndex() < context->GetPage()->GetNumSends(track))
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetParamIndex() + numHardwareSends, &vol, &pan);
             context->UpdateWidgetValue(VAL2DB(vol));
@@ -940,7 +988,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             DAW::SetTrackSendUIVol(track, context->GetParamIndex() + numHardwareSends, DB2VAL(value), 0);
         }
     }
@@ -949,7 +997,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetParamIndex() + numHardwareSends, &vol, &pan);
             
@@ -972,7 +1020,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetSlotIndex() + numHardwareSends, &vol, &pan);
             return panToNormalized(pan);
@@ -983,7 +1031,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetSlotIndex() < context->GetPage()->GetNumSends(track))
             context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
         else
             context->ClearWidget();
@@ -993,7 +1043,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             DAW::SetTrackSendUIPan(track, context->GetSlotIndex() + numHardwareSends, normalizedToPan(value), 0);
         }
     }
@@ -1002,7 +1052,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetSlotIndex() + numHardwareSends, &vol, &pan);
             
@@ -1023,9 +1073,11 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(MediaTrack* track = context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetParamIndex() < context->GetPage()->GetNumSends(track))
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetParamIndex() + numHardwareSends, &vol, &pan);
             context->UpdateWidgetValue(pan * 100.0);
@@ -1038,7 +1090,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             DAW::SetTrackSendUIPan(track, context->GetParamIndex() + numHardwareSends, value / 100.0, 0);
         }
     }
@@ -1047,7 +1099,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             double vol, pan = 0.0;
             DAW::GetTrackSendUIVolPan(track, context->GetParamIndex() + numHardwareSends, &vol, &pan);
             
@@ -1070,7 +1122,7 @@ public:
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
             bool mute = false;
             DAW::GetTrackSendUIMute(track, context->GetSlotIndex() + numHardwareSends, &mute);
             return mute;
@@ -1081,7 +1133,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetSlotIndex() < context->GetPage()->GetNumSends(track))
             context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
         else
             context->ClearWidget();
@@ -1225,7 +1279,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetSlotIndex() < context->GetPage()->GetNumReceives(track))
             context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
         else
             context->ClearWidget();
@@ -1261,7 +1317,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(MediaTrack* track = context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetParamIndex() < context->GetPage()->GetNumReceives(track))
         {
             double vol, pan = 0.0;
             DAW::GetTrackReceiveUIVolPan(track, context->GetParamIndex(), &vol, &pan);
@@ -1316,7 +1374,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetSlotIndex() < context->GetPage()->GetNumReceives(track))
             context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
         else
             context->ClearWidget();
@@ -1352,7 +1412,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(MediaTrack* track = context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetParamIndex() < context->GetPage()->GetNumReceives(track))
         {
             double vol, pan = 0.0;
             DAW::GetTrackReceiveUIVolPan(track, context->GetParamIndex(), &vol, &pan);
@@ -1404,7 +1466,9 @@ public:
     
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
+        MediaTrack* track = context->GetTrack();
+        
+        if(track != nullptr && context->GetSlotIndex() < context->GetPage()->GetNumReceives(track))
             context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
         else
             context->ClearWidget();
@@ -1605,6 +1669,7 @@ class MetronomeVolumeDisplay : public Action
 {
 public:
     string GetName() override { return "MetronomeVolumeDisplay"; }
+    int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     // Should write to the provided argument the metronome volume (in linear factor). Returns true
     // if the call was sucessful, false otherwise.
@@ -1641,7 +1706,7 @@ public:
             if (hasPrefix)
                 str[0] = prefix;
 
-            context->UpdateWidgetValue(string(str));
+            context->UpdateWidgetValue(str);
         }
         else
             context->ClearWidget();
@@ -1695,6 +1760,7 @@ class FXNameDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FXNameDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -1711,25 +1777,22 @@ class FXMenuNameDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FXMenuNameDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            string name = "NoMap";
-            
             if(context->GetSlotIndex() >= DAW::TrackFX_GetCount(track))
-                name= "";
+                context->UpdateWidgetValue("");
             else
             {
                 char fxName[BUFSZ];
                 
                 DAW::TrackFX_GetFXName(track, context->GetSlotIndex(), fxName, sizeof(fxName));
                 
-                name = context->GetSurface()->GetZoneManager()->GetName(fxName);
+                context->UpdateWidgetValue(context->GetSurface()->GetZoneManager()->GetName(fxName));
             }
-            
-            context->UpdateWidgetValue(name);
         }
         else
             context->ClearWidget();
@@ -1776,6 +1839,7 @@ class FXParamNameDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FXParamNameDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -1792,14 +1856,13 @@ class FXParamValueDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FXParamValueDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            char fxParamValue[128];
-            DAW::TrackFX_GetFormattedParamValue(track, context->GetSlotIndex(), context->GetParamIndex(), fxParamValue, sizeof(fxParamValue));
-            context->UpdateWidgetValue(string(fxParamValue));
+            context->UpdateWidgetValue(context->GetPage()->GetFXParamFormattedValue(track, context->GetSlotIndex(), context->GetParamIndex()));
         }
         else
             context->ClearWidget();
@@ -1812,6 +1875,7 @@ class FocusedFXParamNameDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FocusedFXParamNameDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -1819,14 +1883,10 @@ public:
         int fxSlotNum = 0;
         int fxParamNum = 0;
         
-        if(DAW::GetLastTouchedFX(&trackNum, &fxSlotNum, &fxParamNum))
+        if(context->GetPage()->GetLastTouchedFX(trackNum, fxSlotNum, fxParamNum))
         {
             if(MediaTrack* track = DAW::GetTrack(trackNum))
-            {
-                char fxParamName[128];
-                DAW::TrackFX_GetParamName(track, fxSlotNum, fxParamNum, fxParamName, sizeof(fxParamName));
-                context->UpdateWidgetValue(string(fxParamName));
-            }
+                context->UpdateWidgetValue(context->GetPage()->GetFXParamName(track, fxSlotNum, fxParamNum));
         }
         else
             context->ClearWidget();
@@ -1839,6 +1899,7 @@ class FocusedFXParamValueDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FocusedFXParamValueDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -1846,14 +1907,10 @@ public:
         int fxSlotNum = 0;
         int fxParamNum = 0;
         
-        if(DAW::GetLastTouchedFX(&trackNum, &fxSlotNum, &fxParamNum))
+        if(context->GetPage()->GetLastTouchedFX(trackNum, fxSlotNum, fxParamNum))
         {
             if(MediaTrack* track = DAW::GetTrack(trackNum))
-            {
-                char fxParamValue[128];
-                DAW::TrackFX_GetFormattedParamValue(track, fxSlotNum, fxParamNum, fxParamValue, sizeof(fxParamValue));
-                context->UpdateWidgetValue(string(fxParamValue));
-            }
+                context->UpdateWidgetValue(context->GetPage()->GetFXParamFormattedValue(track, fxSlotNum, fxParamNum));
         }
         else
             context->ClearWidget();
@@ -1866,16 +1923,17 @@ class TrackSendNameDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackSendNameDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            string sendTrackName = "";
-            MediaTrack* destTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, 0, context->GetSlotIndex() + DAW::GetTrackNumSends(track, 1), "P_DESTTRACK", 0);;
+            MediaTrack* destTrack = context->GetPage()->GetSendDestination(track, context->GetSlotIndex());
             if(destTrack)
-                sendTrackName = (char *)DAW::GetSetMediaTrackInfo(destTrack, "P_NAME", NULL);
-            context->UpdateWidgetValue(sendTrackName);
+                context->UpdateWidgetValue(context->GetPage()->GetSendDestinationName(track, context->GetSlotIndex()));
+            else
+                context->UpdateWidgetValue("");
         }
         else
             context->ClearWidget();
@@ -1896,9 +1954,9 @@ public:
         if(MediaTrack* track = context->GetTrack())
         {
             string sendTrackName = "No Send Track";
-            MediaTrack* destTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, 0, context->GetSlotIndex() + DAW::GetTrackNumSends(track, 1), "P_DESTTRACK", 0);;
+            MediaTrack* destTrack = context->GetPage()->GetSendDestination(track, context->GetSlotIndex());
             if(destTrack)
-                sendTrackName = (char *)DAW::GetSetMediaTrackInfo(destTrack, "P_NAME", NULL);
+                sendTrackName = context->GetPage()->GetSendDestinationName(track, context->GetSlotIndex());
             TheManager->Speak("Track " + to_string(context->GetPage()->GetIdFromTrack(destTrack)) + " " + string(sendTrackName));
         }
     }
@@ -1910,21 +1968,22 @@ class TrackSendVolumeDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackSendVolumeDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* destTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, 0, context->GetSlotIndex() + DAW::GetTrackNumSends(track, 1), "P_DESTTRACK", 0);;
+            MediaTrack* destTrack = context->GetPage()->GetSendDestination(track, context->GetSlotIndex());
             if(destTrack)
             {
-                int numHardwareSends = DAW::GetTrackNumSends(track, 1);
+                int numHardwareSends = context->GetPage()->GetNumHardwareSends(track);
                 double vol, pan = 0.0;
                 DAW::GetTrackSendUIVolPan(track, context->GetSlotIndex() + numHardwareSends, &vol, &pan);
 
                 char trackVolume[128];
                 snprintf(trackVolume, sizeof(trackVolume), "%7.2lf", VAL2DB(vol));
-                context->UpdateWidgetValue(string(trackVolume));
+                context->UpdateWidgetValue(trackVolume);
             }
             else
                 context->ClearWidget();
@@ -1940,15 +1999,16 @@ class TrackSendPanDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackSendPanDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* destTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, 0, context->GetSlotIndex() + DAW::GetTrackNumSends(track, 1), "P_DESTTRACK", 0);;
+            MediaTrack* destTrack = context->GetPage()->GetSendDestination(track, context->GetSlotIndex());
             if(destTrack)
             {
-                double panVal = DAW::GetTrackSendInfo_Value(track, 0, context->GetSlotIndex() + DAW::GetTrackNumSends(track, 1), "D_PAN");
+                double panVal = DAW::GetTrackSendInfo_Value(track, 0, context->GetSlotIndex() + context->GetPage()->GetNumHardwareSends(track), "D_PAN");
                 
                 context->UpdateWidgetValue(context->GetPanValueString(panVal, ""));
             }
@@ -1966,19 +2026,20 @@ class TrackSendPrePostDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackSendPrePostDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* destTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, 0, context->GetSlotIndex() + DAW::GetTrackNumSends(track, 1), "P_DESTTRACK", 0);;
+            MediaTrack* destTrack = context->GetPage()->GetSendDestination(track, context->GetSlotIndex());
             if(destTrack)
             {
                 // I_SENDMODE : returns int *, 0=post-fader, 1=pre-fx, 2=post-fx (deprecated), 3=post-fx
                 
-                double prePostVal = DAW::GetTrackSendInfo_Value(track, 0, context->GetSlotIndex() + DAW::GetTrackNumSends(track, 1), "I_SENDMODE");
+                double prePostVal = DAW::GetTrackSendInfo_Value(track, 0, context->GetSlotIndex() + context->GetPage()->GetNumHardwareSends(track), "I_SENDMODE");
                 
-                string prePostValueString = "";
+                const char* prePostValueString = "";
                 
                 if(prePostVal == 0)
                     prePostValueString = "PostPan";
@@ -2003,17 +2064,16 @@ class TrackReceiveNameDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackReceiveNameDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* srcTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, -1, context->GetSlotIndex(), "P_SRCTRACK", 0);
+            MediaTrack* srcTrack = context->GetPage()->GetReceiveSource(track, context->GetSlotIndex());
             if(srcTrack)
             {
-                string receiveTrackName = "";
-                receiveTrackName = (char *)DAW::GetSetMediaTrackInfo(srcTrack, "P_NAME", NULL);
-                context->UpdateWidgetValue(receiveTrackName);
+                context->UpdateWidgetValue(context->GetPage()->GetReceiveSourceName(track, context->GetSlotIndex()));
             }
             else
                 context->ClearWidget();
@@ -2036,10 +2096,10 @@ public:
 
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* srcTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, -1, context->GetSlotIndex(), "P_SRCTRACK", 0);
+            MediaTrack* srcTrack = context->GetPage()->GetReceiveSource(track, context->GetSlotIndex());
             if(srcTrack)
             {
-                string receiveTrackName = (char *)DAW::GetSetMediaTrackInfo(srcTrack, "P_NAME", NULL);
+                string receiveTrackName = context->GetPage()->GetReceiveSourceName(track, context->GetSlotIndex());
                 TheManager->Speak("Track " + to_string(context->GetPage()->GetIdFromTrack(srcTrack)) + " " + receiveTrackName);
             }
             else
@@ -2054,17 +2114,18 @@ class TrackReceiveVolumeDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackReceiveVolumeDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* srcTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, -1, context->GetSlotIndex(), "P_SRCTRACK", 0);
+            MediaTrack* srcTrack = context->GetPage()->GetReceiveSource(track, context->GetSlotIndex());
             if(srcTrack)
             {
                 char trackVolume[128];
                 snprintf(trackVolume, sizeof(trackVolume), "%7.2lf", VAL2DB(DAW::GetTrackSendInfo_Value(track, -1, context->GetSlotIndex(), "D_VOL")));
-                context->UpdateWidgetValue(string(trackVolume));
+                context->UpdateWidgetValue(trackVolume);
             }
             else
                 context->ClearWidget();
@@ -2080,12 +2141,13 @@ class TrackReceivePanDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackReceivePanDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* srcTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, -1, context->GetSlotIndex(), "P_SRCTRACK", 0);
+            MediaTrack* srcTrack = context->GetPage()->GetReceiveSource(track, context->GetSlotIndex());
             if(srcTrack)
             {
                 double panVal = DAW::GetTrackSendInfo_Value(track, -1, context->GetSlotIndex(), "D_PAN");
@@ -2106,19 +2168,20 @@ class TrackReceivePrePostDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackReceivePrePostDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            MediaTrack* srcTrack = (MediaTrack *)DAW::GetSetTrackSendInfo(track, -1, context->GetSlotIndex(), "P_SRCTRACK", 0);
+            MediaTrack* srcTrack = context->GetPage()->GetReceiveSource(track, context->GetSlotIndex());
             if(srcTrack)
             {
                 // I_SENDMODE : returns int *, 0=post-fader, 1=pre-fx, 2=post-fx (deprecated), 3=post-fx
                 
                 double prePostVal = DAW::GetTrackSendInfo_Value(track, -1, context->GetSlotIndex(), "I_SENDMODE");
                 
-                string prePostValueString = "";
+                const char* prePostValueString = "";
                 
                 if(prePostVal == 0)
                     prePostValueString = "PostPan";
@@ -2143,6 +2206,7 @@ class FixedTextDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FixedTextDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -2156,10 +2220,11 @@ class FixedRGBColorDisplay : public Action
 {
 public:
     virtual string GetName() override { return "FixedRGBColorDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        context->UpdateWidgetValue(0);
+        context->UpdateWidgetValue(0.0);
     }
 };
 
@@ -2169,16 +2234,14 @@ class TrackNameDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackNameDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            char buf[BUFSZ];
-            
-            DAW::GetTrackName(track, buf, sizeof(buf));
-            
-            context->UpdateWidgetValue(string(buf));
+            context->UpdateWidgetValue(context->GetPage()->GetTrackState(track).GetName());
         }
         else
             context->ClearWidget();
@@ -2191,6 +2254,7 @@ class TrackNumberDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackNumberDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -2200,7 +2264,7 @@ public:
             char idx[128];
             snprintf(idx, sizeof(idx), "%d", (int)index);
 
-            context->UpdateWidgetValue(string(idx));
+            context->UpdateWidgetValue(idx);
         }
         else
             context->ClearWidget();
@@ -2213,17 +2277,16 @@ class TrackVolumeDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackVolumeDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            double vol, pan = 0.0;
-            DAW::GetTrackUIVolPan(track, &vol, &pan);
-
             char trackVolume[128];
-            snprintf(trackVolume, sizeof(trackVolume), "%7.2lf", VAL2DB(vol));
-            context->UpdateWidgetValue(string(trackVolume));
+            snprintf(trackVolume, sizeof(trackVolume), "%7.2lf", VAL2DB(context->GetPage()->GetTrackState(track).GetVolume()));
+            context->UpdateWidgetValue(trackVolume);
         }
         else
             context->ClearWidget();
@@ -2236,15 +2299,14 @@ class TrackPanDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            double vol, pan = 0.0;
-            DAW::GetTrackUIVolPan(track, &vol, &pan);
-
-            context->UpdateWidgetValue(context->GetPanValueString(pan, ""));
+            context->UpdateWidgetValue(context->GetPanValueString(context->GetPage()->GetTrackState(track).GetPan(), ""));
         }
         else
             context->ClearWidget();
@@ -2257,14 +2319,14 @@ class TrackPanWidthDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanWidthDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            double widthVal = DAW::GetMediaTrackInfo_Value(track, "D_WIDTH");
-            
-            context->UpdateWidgetValue(context->GetPanWidthValueString(widthVal));
+            context->UpdateWidgetValue(context->GetPanWidthValueString(context->GetPage()->GetTrackState(track).GetWidth()));
         }
         else
             context->ClearWidget();
@@ -2277,14 +2339,14 @@ class TrackPanLeftDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanLeftDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            double panVal = DAW::GetMediaTrackInfo_Value(track, "D_DUALPANL");
-            
-            context->UpdateWidgetValue(context->GetPanValueString(panVal, "L"));
+            context->UpdateWidgetValue(context->GetPanValueString(context->GetPage()->GetTrackState(track).GetDualPanL(), "L"));
         }
         else
             context->ClearWidget();
@@ -2297,14 +2359,14 @@ class TrackPanRightDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanRightDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            double panVal = DAW::GetMediaTrackInfo_Value(track, "D_DUALPANR");
-            
-            context->UpdateWidgetValue(context->GetPanValueString(panVal, "R"));
+            context->UpdateWidgetValue(context->GetPanValueString(context->GetPage()->GetTrackState(track).GetDualPanR(), "R"));
         }
         else
             context->ClearWidget();
@@ -2317,22 +2379,19 @@ class TrackPanAutoLeftDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanAutoLeftDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            if(GetPanMode(track) == 6)
-            {
-                double panVal = DAW::GetMediaTrackInfo_Value(track, "D_DUALPANL");
-                context->UpdateWidgetValue(context->GetPanValueString(panVal, "L"));
-            }
+            TrackState &state = context->GetPage()->GetTrackState(track);
+            
+            if(state.GetPanMode() == 6)
+                context->UpdateWidgetValue(context->GetPanValueString(state.GetDualPanL(), "L"));
             else
-            {
-                double vol, pan = 0.0;
-                DAW::GetTrackUIVolPan(track, &vol, &pan);
-                context->UpdateWidgetValue(context->GetPanValueString(pan, ""));
-            }
+                context->UpdateWidgetValue(context->GetPanValueString(state.GetPan(), ""));
         }
         else
             context->ClearWidget();
@@ -2345,21 +2404,19 @@ class TrackPanAutoRightDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackPanAutoRightDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            if(GetPanMode(track) == 6)
-            {
-                double panVal = DAW::GetMediaTrackInfo_Value(track, "D_DUALPANR");
-                context->UpdateWidgetValue(context->GetPanValueString(panVal, "R"));
-            }
+            TrackState &state = context->GetPage()->GetTrackState(track);
+            
+            if(state.GetPanMode() == 6)
+                context->UpdateWidgetValue(context->GetPanValueString(state.GetDualPanR(), "R"));
             else
-            {
-                double widthVal = DAW::GetMediaTrackInfo_Value(track, "D_WIDTH");
-                context->UpdateWidgetValue(context->GetPanWidthValueString(widthVal));
-            }
+                context->UpdateWidgetValue(context->GetPanWidthValueString(state.GetWidth()));
         }
         else
             context->ClearWidget();
@@ -2567,6 +2624,7 @@ class TrackSelect : public Action
 {
 public:
     virtual string GetName() override { return "TrackSelect"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
 
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -2578,8 +2636,8 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+            context->UpdateWidgetValue(context->GetPage()->GetTrackState(track).GetIsSelected());
         else
             context->ClearWidget();
     }
@@ -2602,6 +2660,7 @@ class TrackUniqueSelect : public Action
 {
 public:
     virtual string GetName() override { return "TrackUniqueSelect"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
 
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -2613,8 +2672,8 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+            context->UpdateWidgetValue(context->GetPage()->GetTrackState(track).GetIsSelected());
         else
             context->ClearWidget();
     }
@@ -2637,6 +2696,7 @@ class TrackRangeSelect : public Action
 {
 public:
     virtual string GetName() override { return "TrackRangeSelect"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
 
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -2648,8 +2708,8 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+            context->UpdateWidgetValue(context->GetPage()->GetTrackState(track).GetIsSelected());
         else
             context->ClearWidget();
     }
@@ -2675,7 +2735,7 @@ public:
             if(currentTrack == context->GetTrack())
                 trackIndex = i;
             
-            if(DAW::GetMediaTrackInfo_Value(currentTrack, "I_SELECTED"))
+            if(context->GetPage()->GetIsTrackSelected(currentTrack))
             {
                 selectedTrackIndex = i;
                 currentlySelectedCount++;
@@ -2712,6 +2772,7 @@ class TrackRecordArm : public Action
 {
 public:
     virtual string GetName() override { return "TrackRecordArm"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
 
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -2723,8 +2784,8 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+            context->UpdateWidgetValue(context->GetPage()->GetTrackState(track).GetIsRecArmed());
         else
             context->ClearWidget();
     }
@@ -2746,6 +2807,7 @@ class TrackMute : public Action
 {
 public:
     virtual string GetName() override { return "TrackMute"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
 
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -2761,8 +2823,8 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+            context->UpdateWidgetValue(context->GetPage()->GetTrackState(track).GetIsMuted());
         else
             context->ClearWidget();
     }
@@ -2786,6 +2848,7 @@ class TrackSolo : public Action
 {
 public:
     virtual string GetName() override { return "TrackSolo"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
 
     virtual double GetCurrentNormalizedValue(ActionContext* context) override
     {
@@ -2797,8 +2860,8 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        if(context->GetTrack())
-            context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        if(MediaTrack* track = context->GetTrack())
+            context->UpdateWidgetValue(context->GetPage()->GetTrackState(track).GetIsSoloed());
         else
             context->ClearWidget();
     }
@@ -2928,7 +2991,18 @@ public:
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        context->UpdateWidgetValue(GetCurrentNormalizedValue(context));
+        double retVal = 0.0;
+        
+        for(auto selectedTrack : context->GetPage()->GetSelectedTracks())
+        {
+            if(context->GetIntParam() == context->GetPage()->GetTrackState(selectedTrack).GetAutoMode())
+            {
+                retVal = 1.0;
+                break;
+            }
+        }
+
+        context->UpdateWidgetValue(retVal);
     }
     
     virtual void Do(ActionContext* context, double value) override
@@ -2953,7 +3027,7 @@ public:
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
-            context->UpdateWidgetValue(context->GetPage()->GetAutoModeDisplayName(DAW::GetMediaTrackInfo_Value(track, "I_AUTOMODE")));
+            context->UpdateWidgetValue(context->GetPage()->GetAutoModeDisplayName(context->GetPage()->GetTrackState(track).GetAutoMode()));
     }
     
     virtual void Do(ActionContext* context, double value) override
@@ -3032,11 +3106,12 @@ class TrackAutoModeDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackAutoModeDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
-            context->UpdateWidgetValue(context->GetPage()->GetAutoModeDisplayName(DAW::GetMediaTrackInfo_Value(track, "I_AUTOMODE")));
+            context->UpdateWidgetValue(context->GetPage()->GetAutoModeDisplayName(context->GetPage()->GetTrackState(track).GetAutoMode()));
     }
 };
 
@@ -3046,12 +3121,13 @@ class TrackVCALeaderDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackVCALeaderDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            if(DAW::GetTrackGroupMembership(track, "VOLUME_VCA_LEAD") != 0 || DAW::GetTrackGroupMembershipHigh(track, "VOLUME_VCA_LEAD") != 0)
+            if(context->GetPage()->GetIsVCALeader(track))
                 context->UpdateWidgetValue("Leader");
             else
                 context->UpdateWidgetValue("");
@@ -3067,12 +3143,13 @@ class TrackFolderParentDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackFolderParentDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            if(DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH") == 1)
+            if(context->GetPage()->GetIsFolderParent(track))
                 context->UpdateWidgetValue("Parent");
             else
                 context->UpdateWidgetValue("");
@@ -3088,6 +3165,7 @@ class GlobalAutoModeDisplay : public Action
 {
 public:
     virtual string GetName() override { return "GlobalAutoModeDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -3102,6 +3180,8 @@ class TrackInputMonitorDisplay : public Action
 {
 public:
     virtual string GetName() override { return "TrackInputMonitorDisplay"; }
+    virtual bool GetIsTrackStateFeedback() override { return true; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
     
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -3116,10 +3196,11 @@ class MCUTimeDisplay : public Action
 {
 public:
     virtual string GetName() override { return "MCUTimeDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassTime; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        context->UpdateWidgetValue(0);
+        context->UpdateWidgetValue(0.0);
     }
 };
 
@@ -3129,10 +3210,12 @@ class OSCTimeDisplay : public Action
 {
 public:
     virtual string GetName() override { return "OSCTimeDisplay"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassTime; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
-        string timeStr = "";
+        char timeStr[128];
+        timeStr[0] = 0;
         
         double pp=(DAW::GetPlayState()&1) ? DAW::GetPlayPosition() : DAW::GetCursorPosition();
 
@@ -3155,20 +3238,12 @@ public:
             if (toptr)
                 pp+=*toptr;
             
-            timeStr = to_string((int)pp) + " " + to_string(((int)(pp*100.0))%100);
+            snprintf(timeStr, sizeof(timeStr), "%d %d", (int)pp, ((int)(pp*100.0))%100);
         }
         else if(tmode==4) // samples
-        {
-            char buf[128];
-            DAW::format_timestr_pos(pp, buf, sizeof(buf), 4);
-            timeStr = string(buf);
-        }
+            DAW::format_timestr_pos(pp, timeStr, sizeof(timeStr), 4);
         else if(tmode == 5) // frames
-        {
-            char buf[128];
-            DAW::format_timestr_pos(pp, buf, sizeof(buf), 5);
-            timeStr = string(buf);
-        }
+            DAW::format_timestr_pos(pp, timeStr, sizeof(timeStr), 5);
         else if(tmode > 0)
         {
             int num_measures=0;
@@ -3183,16 +3258,9 @@ public:
             
             int *measptr = TheManager->GetMeasOffsPtr();
           
-            timeStr = to_string(num_measures+1+(measptr ? *measptr : 0)) + " " + to_string((int)(nbeats + 1)) + " ";
-            
             int subBeats = (int)(1000.0 * beats);
 
-            if(subBeats < 10)
-                timeStr += "00";
-            else if(subBeats < 100)
-                timeStr += "0";
-            
-            timeStr += to_string(subBeats);
+            snprintf(timeStr, sizeof(timeStr), "%d %d %03d", num_measures+1+(measptr ? *measptr : 0), (int)(nbeats + 1), subBeats);
         }
         else
         {
@@ -3203,32 +3271,10 @@ public:
             int fr=(int)((pp-ipp)*1000.0);
             
             int hours = (int)(ipp/3600);
-            if(hours < 10)
-                timeStr += "00";
-            else if(hours < 100)
-                timeStr += "0";
-            
-            timeStr += to_string(hours) + ":";
-            
             int minutes = ((int)(ipp/60)) %3600;
-            if(minutes < 10)
-                timeStr += "0";
-            
-            timeStr += to_string(minutes) + ":";
-
             int seconds = ((int)ipp) %60;
-            if(seconds < 10)
-                timeStr += "0";
-            
-            timeStr += to_string(seconds) + ":";
 
-            int frames =(int)fr;
-            if(frames < 10)
-                timeStr += "00";
-            else if(frames < 100)
-                timeStr += "0";
-            
-            timeStr += to_string((int)fr);
+            snprintf(timeStr, sizeof(timeStr), "%03d:%02d:%02d:%03d", hours, minutes, seconds, fr);
         }
 
         context->UpdateWidgetValue(timeStr);
@@ -3241,15 +3287,16 @@ class TrackOutputMeter : public Action
 {
 public:
     virtual string GetName() override { return "TrackOutputMeter"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {           
-            if(DAW::AnyTrackSolo(nullptr) && ! DAW::GetMediaTrackInfo_Value(track, "I_SOLO"))
+            if(context->GetPage()->GetIsTrackMeterSilencedBySolo(track))
                 context->ClearWidget();
             else
-                context->UpdateWidgetValue(volToNormalized(DAW::Track_GetPeakInfo(track, context->GetIntParam())));
+                context->UpdateWidgetValue(volToNormalized(context->GetPage()->GetTrackPeak(track, context->GetIntParam())));
         }
         else
             context->ClearWidget();
@@ -3262,14 +3309,15 @@ class TrackOutputMeterAverageLR : public Action
 {
 public:
     virtual string GetName() override { return "TrackOutputMeterAverageLR"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            double lrVol = (DAW::Track_GetPeakInfo(track, 0) + DAW::Track_GetPeakInfo(track, 1)) / 2.0;
+            double lrVol = (context->GetPage()->GetTrackPeak(track, 0) + context->GetPage()->GetTrackPeak(track, 1)) / 2.0;
             
-            if(DAW::AnyTrackSolo(nullptr) && ! DAW::GetMediaTrackInfo_Value(track, "I_SOLO"))
+            if(context->GetPage()->GetIsTrackMeterSilencedBySolo(track))
                 context->ClearWidget();
             else
                 context->UpdateWidgetValue(volToNormalized(lrVol));
@@ -3285,17 +3333,18 @@ class TrackOutputMeterMaxPeakLR : public Action
 {
 public:
     virtual string GetName() override { return "TrackOutputMeterMaxPeakLR"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
         if(MediaTrack* track = context->GetTrack())
         {
-            double lVol = DAW::Track_GetPeakInfo(track, 0);
-            double rVol = DAW::Track_GetPeakInfo(track, 1);
+            double lVol = context->GetPage()->GetTrackPeak(track, 0);
+            double rVol = context->GetPage()->GetTrackPeak(track, 1);
             
             double lrVol =  lVol > rVol ? lVol : rVol;
             
-            if(DAW::AnyTrackSolo(nullptr) && ! DAW::GetMediaTrackInfo_Value(track, "I_SOLO"))
+            if(context->GetPage()->GetIsTrackMeterSilencedBySolo(track))
                 context->ClearWidget();
             else
                 context->UpdateWidgetValue(volToNormalized(lrVol));
@@ -3311,6 +3360,7 @@ class FXGainReductionMeter : public Action
 {
 public:
     virtual string GetName() override { return "FXGainReductionMeter"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
     virtual void RequestUpdate(ActionContext* context) override
     {
@@ -15,6 +15,55 @@ extern reaper_plugin_info_t *g_reaper_plugin_info;
 
 WDL_Mutex WDL_mutex;
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Symbols
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static unordered_map<string, int> &GetSymbolIds()
+{
+    // In the same order as the Symbols enum
+    static unordered_map<string, int> symbolIds =
+    {
+        { "Track", SymbolTrack },
+        { "VCA", SymbolVCA },
+        { "Folder", SymbolFolder },
+        { "TrackSend", SymbolTrackSend },
+        { "TrackReceive", SymbolTrackReceive },
+        { "TrackFXMenu", SymbolTrackFXMenu },
+        { "SelectedTrack", SymbolSelectedTrack },
+        { "SelectedTrackSend", SymbolSelectedTrackSend },
+        { "SelectedTrackReceive", SymbolSelectedTrackReceive },
+        { "SelectedTrackFXMenu", SymbolSelectedTrackFXMenu },
+        { "ToggleEnableFocusedFXMapping", SymbolToggleEnableFocusedFXMapping },
+        { "OnTrackSelection", SymbolOnTrackSelection },
+        { "OnPageEnter", SymbolOnPageEnter },
+        { "OnPageLeave", SymbolOnPageLeave },
+        { "OnInitialization", SymbolOnInitialization },
+        { "OnPlayStart", SymbolOnPlayStart },
+        { "OnPlayStop", SymbolOnPlayStop },
+        { "OnRecordStart", SymbolOnRecordStart },
+        { "OnRecordStop", SymbolOnRecordStop },
+        { "OnZoneActivation", SymbolOnZoneActivation },
+        { "OnZoneDeactivation", SymbolOnZoneDeactivation },
+    };
+    
+    return symbolIds;
+}
+
+int InternSymbol(const string &name)
+{
+    unordered_map<string, int> &symbolIds = GetSymbolIds();
+    
+    auto it = symbolIds.find(name);
+    
+    if(it != symbolIds.end())
+        return it->second;
+    
+    int symbol = symbolIds.size();
+    symbolIds[name] = symbol;
+    
+    return symbol;
+}
+
 string GetLineEnding()
 {
 #ifdef WIN32
@@ -1215,6 +1264,8 @@ static void ProcessMidiWidget(int &lineNumber, ifstream &surfaceTemplateFile, ve
             new Encoder7Bit_Midi_CSIMessageGenerator(surface, widget, new MIDI_event_ex_t(strToHex(tokenLines[i][1]), strToHex(tokenLines[i][2]), strToHex(tokenLines[i][3])));
         else if(widgetType == "Touch" && size == 7)
             new Touch_Midi_CSIMessageGenerator(surface, widget, new MIDI_event_ex_t(strToHex(tokenLines[i][1]), strToHex(tokenLines[i][2]), strToHex(tokenLines[i][3])), new MIDI_event_ex_t(strToHex(tokenLines[i][4]), strToHex(tokenLines[i][5]), strToHex(tokenLines[i][6])));
+        else if(widgetType == "Refresh" && size == 2)
+            widget->SetFeedbackClass(GetFeedbackClassForName(tokenLines[i][1]));
         // Feedback Processors
         FeedbackProcessor* feedbackProcessor = nullptr;
 
@@ -1429,6 +1480,8 @@ static void ProcessOSCWidget(int &lineNumber, ifstream &surfaceTemplateFile, vec
             widget->AddFeedbackProcessor(new OSC_FeedbackProcessor(surface, widget, tokenLine[1]));
         else if(tokenLine.size() > 1 && tokenLine[0] == "FB_IntProcessor")
             widget->AddFeedbackProcessor(new OSC_IntFeedbackProcessor(surface, widget, tokenLine[1]));
+        else if(tokenLine.size() > 1 && tokenLine[0] == "Refresh")
+            widget->SetFeedbackClass(GetFeedbackClassForName(tokenLine[1]));
     }
 }
 
@@ -1707,6 +1760,8 @@ void Manager::InitActionsDictionary()
 void Manager::Init()
 {
     pages_.clear();
+    idleQuietTime_ = 0.0;
+    idleRunInterval_ = 0.0;
     
     map<string, Midi_ControlSurfaceIO*> midiSurfaces;
     map<string, OSC_ControlSurfaceIO*> oscSurfaces;
@@ -1737,6 +1792,10 @@ void Manager::Init()
     
     int lineNumber = 0;
     bool shouldAutoScan = false;
+    double meterDecayDBPerSecond = 0.0;
+    double meterPeakHoldTime = 0.0;
+    double feedbackBudget = 0.0;
+    map<int, double> refreshRates;
     
     try
     {
@@ -1776,6 +1835,20 @@ void Manager::Init()
                     midiSurfaces[tokens[1]] = new Midi_ControlSurfaceIO(tokens[1], GetMidiInputForPort(atoi(tokens[2].c_str())), GetMidiOutputForPort(atoi(tokens[3].c_str())));
                 else if(tokens[0] == OSCSurfaceToken && tokens.size() == 5)
                     oscSurfaces[tokens[1]] = new OSC_ControlSurfaceIO(tokens[1], tokens[2], tokens[3], tokens[4]);
+                else if(tokens[0] == MeterBallisticsToken && tokens.size() == 3)
+                {
+                    meterDecayDBPerSecond = atof(tokens[1].c_str());
+                    meterPeakHoldTime = atof(tokens[2].c_str());
+                }
+                else if(tokens[0] == FeedbackBudgetToken && tokens.size() == 2)
+                    feedbackBudget = atof(tokens[1].c_str());
+                else if(tokens[0] == RefreshRateToken && tokens.size() == 3 && GetFeedbackClassForName(tokens[1]) != FeedbackClassUnspecified)
+                    refreshRates[GetFeedbackClassForName(tokens[1])] = atof(tokens[2].c_str());
+                else if(tokens[0] == IdleThrottleToken && tokens.size() == 3)
+                {
+                    idleQuietTime_ = atof(tokens[1].c_str());
+                    idleRunInterval_ = atof(tokens[2].c_str());
+                }
                 else if(tokens[0] == PageToken)
                 {
                     bool followMCP = true;
@@ -1831,6 +1904,15 @@ void Manager::Init()
             lineNumber++;
         }
         
+        for(auto page : pages_)
+        {
+            page->SetMeterBallistics(meterDecayDBPerSecond, meterPeakHoldTime);
+            page->SetFeedbackBudget(feedbackBudget);
+            
+            for(auto [feedbackClass, rate] : refreshRates)
+                page->SetFeedbackRefreshRate(feedbackClass, rate);
+        }
+        
         // Restore the PageIndex
         currentPageIndex_ = 0;
         
@@ -1904,7 +1986,7 @@ MediaTrack* FocusedFXNavigator::GetTrack()
     int itemNumber = 0;
     int fxIndex = 0;
     
-    if(DAW::GetFocusedFX2(&trackNumber, &itemNumber, &fxIndex) == 1) // Track FX
+    if(page_->GetFocusedFX(trackNumber, itemNumber, fxIndex) == 1) // Track FX
         return DAW::GetTrack(trackNumber);
     else
         return nullptr;
@@ -1937,7 +2019,7 @@ ActionContext::ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zo
                         noFeedback_ = true;
                 }
                 else
-                    widgetProperties_[kvp[0]] = kvp[1];
+                    widgetProperties_.SetProperty(kvp[0], kvp[1]);
             }
         }
         else
@@ -1963,9 +2045,11 @@ ActionContext::ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zo
         paramIndex_ = atol(params[1].c_str());
     }
     
+    ActionContextConfig config;
+    
     // Action with string param
     if(params.size() > 1)
-        stringParam_ = params[1];
+        config.stringParam = params[1];
     
     if(actionName == "TrackVolumeDB" || actionName == "TrackSendVolumeDB")
     {
@@ -2015,22 +2099,22 @@ ActionContext::ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zo
         paramIndex_ = atol(params[1].c_str());
         
         if(params.size() > 2 && params[2] != "{" && params[2] != "[")
-            fxParamDisplayName_ = params[2];
+            config.fxParamDisplayName = params[2];
     }
     
     if(params.size() > 1 && (actionName == "Broadcast" || actionName == "Receive" || actionName == "Activate" || actionName == "Deactivate" || actionName == "ToggleActivation"))
     {
         for(int i = 1; i < params.size(); i++)
-            zoneNames_.push_back(params[i]);
+            config.zoneNames.push_back(params[i]);
     }
 
     if(params.size() > 0)
-        SetColor(params, supportsColor_, supportsTrackColor_, colorValues_);
+        SetColor(params, supportsColor_, supportsTrackColor_, config.colorValues);
     
-    GetSteppedValues(widget, GetZone()->GetName(), paramIndex_, params, deltaValue_, acceleratedDeltaValues_, rangeMinimum_, rangeMaximum_, steppedValues_, acceleratedTickValues_);
+    GetSteppedValues(widget, GetZone()->GetName(), paramIndex_, params, deltaValue_, config.acceleratedDeltaValues, rangeMinimum_, rangeMaximum_, config.steppedValues, config.acceleratedTickValues);
 
-    if(acceleratedTickValues_.size() < 1)
-        acceleratedTickValues_.push_back(10);
+    if(! config.GetIsEmpty())
+        config_ = make_unique<ActionContextConfig>(move(config));
 }
 
 Page* ActionContext::GetPage()
@@ -2053,7 +2137,7 @@ int ActionContext::GetSlotIndex()
     return zone_->GetSlotIndex();
 }
 
-string ActionContext::GetName()
+const string &ActionContext::GetName()
 {
     return zone_->GetNameOrAlias();
 }
@@ -2069,12 +2153,68 @@ void ActionContext::RunDeferredActions()
     }
 }
 
-void ActionContext::RequestUpdate()
+int ActionContext::GetFeedbackClass()
+{
+    // the Zone setting wins, then the Widget's, then the Action's
+    if(feedbackClass_ == FeedbackClassUnspecified)
+    {
+        feedbackClass_ = widgetProperties_.feedbackClass;
+        
+        if(feedbackClass_ == FeedbackClassUnspecified)
+            feedbackClass_ = widget_->GetFeedbackClass();
+        
+        if(feedbackClass_ == FeedbackClassUnspecified)
+            feedbackClass_ = action_->GetFeedbackClass();
+    }
+    
+    return feedbackClass_;
+}
+
+bool ActionContext::PrepareUpdate()
 {
     if(noFeedback_)
-        return;
+        return false;
+    
+    if(action_->GetIsTrackStateFeedback() && ! supportsTrackColor_)
+    {
+        MediaTrack* track = GetTrack();
+        int generation = track != nullptr ? GetPage()->GetTrackState(track).GetGeneration() : 0;
+        
+        // Nothing this context displays has changed since it last wrote to the Widget
+        if(track != nullptr && widget_->GetFeedbackOwner() == this && track == feedbackTrack_ && generation == feedbackTrackGeneration_)
+            return false;
+        
+        feedbackTrack_ = track;
+        feedbackTrackGeneration_ = generation;
+    }
+    
+    widget_->SetFeedbackOwner(this);
+    
+    return true;
+}
+
+void ActionContext::RequestUpdate()
+{
+    if(PrepareUpdate())
+        action_->RequestUpdate(this);
+}
+
+const string &ActionContext::GetFxParamDisplayName()
+{
+    static const string emptyName = "";
+    
+    if(GetConfig().fxParamDisplayName != "")
+        return GetConfig().fxParamDisplayName;
+    else if(MediaTrack* track = GetTrack())
+        return GetPage()->GetFXParamName(track, GetSlotIndex(), paramIndex_);
     
-    action_->RequestUpdate(this);
+    return emptyName;
+}
+
+void ActionContext::SetTrackIsDirty()
+{
+    if(MediaTrack* track = GetTrack())
+        GetPage()->SetTrackIsDirty(track);
 }
 
 void ActionContext::RequestUpdateWidgetMode()
@@ -2092,14 +2232,16 @@ void ActionContext::UpdateColorValue(double value)
     if(supportsColor_)
     {
         currentColorIndex_ = value == 0 ? 0 : 1;
-        if(colorValues_.size() > currentColorIndex_)
-            widget_->UpdateColorValue(colorValues_[currentColorIndex_]);
+        const vector<rgba_color> &colorValues = GetConfig().colorValues;
+        
+        if((int)colorValues.size() > currentColorIndex_)
+            widget_->UpdateColorValue(colorValues[currentColorIndex_]);
     }
 }
 
 void ActionContext::UpdateWidgetValue(double value)
 {
-    if(steppedValues_.size() > 0)
+    if(GetConfig().steppedValues.size() > 0)
         SetSteppedValueIndex(value);
 
     value = isFeedbackInverted_ == false ? value : 1.0 - value;
@@ -2116,16 +2258,26 @@ void ActionContext::UpdateTrackColor()
 {
     if(MediaTrack* track = zone_->GetNavigator()->GetTrack())
     {
-        rgba_color color = DAW::GetTrackColor(track);
+        rgba_color color = GetPage()->GetTrackColor(track);
         widget_->UpdateColorValue(color);
     }
 }
 
-void ActionContext::UpdateWidgetValue(string value)
+void ActionContext::UpdateWidgetValue(const string &value)
 {
     widget_->UpdateValue(widgetProperties_, value);
 }
 
+void ActionContext::UpdateWidgetValue(const char* value)
+{
+    // Formatted values and literals share one string so they reach the widget without building a temporary each cycle
+    static string scratchValue;
+    
+    scratchValue = value;
+    
+    widget_->UpdateValue(widgetProperties_, scratchValue);
+}
+
 void ActionContext::DoAction(double value)
 {
     if(holdDelayAmount_ != 0.0)
@@ -2143,19 +2295,21 @@ void ActionContext::DoAction(double value)
     }
     else
     {
-        if(steppedValues_.size() > 0)
+        const vector<double> &steppedValues = GetConfig().steppedValues;
+        
+        if(steppedValues.size() > 0)
         {
             if(value != 0.0) // ignore release messages
             {
-                if(steppedValuesIndex_ == steppedValues_.size() - 1)
+                if(steppedValuesIndex_ == (int)steppedValues.size() - 1)
                 {
-                    if(steppedValues_[0] < steppedValues_[steppedValuesIndex_]) // GAW -- only wrap if 1st value is lower
+                    if(steppedValues[0] < steppedValues[steppedValuesIndex_]) // GAW -- only wrap if 1st value is lower
                         steppedValuesIndex_ = 0;
                 }
                 else
                     steppedValuesIndex_++;
                 
-                DoRangeBoundAction(steppedValues_[steppedValuesIndex_]);
+                DoRangeBoundAction(steppedValues[steppedValuesIndex_]);
             }
         }
         else
@@ -2165,7 +2319,7 @@ void ActionContext::DoAction(double value)
 
 void ActionContext::DoRelativeAction(double delta)
 {
-    if(steppedValues_.size() > 0)
+    if(GetConfig().steppedValues.size() > 0)
         DoSteppedValueAction(delta);
     else
         DoRangeBoundAction(action_->GetCurrentNormalizedValue(this) + (deltaValue_ != 0.0 ? (delta > 0 ? deltaValue_ : -deltaValue_) : delta));
@@ -2173,9 +2327,9 @@ void ActionContext::DoRelativeAction(double delta)
 
 void ActionContext::DoRelativeAction(int accelerationIndex, double delta)
 {
-    if(steppedValues_.size() > 0)
+    if(GetConfig().steppedValues.size() > 0)
         DoAcceleratedSteppedValueAction(accelerationIndex, delta);
-    else if(acceleratedDeltaValues_.size() > 0)
+    else if(GetConfig().acceleratedDeltaValues.size() > 0)
         DoAcceleratedDeltaValueAction(accelerationIndex, delta);
     else
         DoRangeBoundAction(action_->GetCurrentNormalizedValue(this) +  (deltaValue_ != 0.0 ? (delta > 0 ? deltaValue_ : -deltaValue_) : delta));
@@ -2190,18 +2344,22 @@ void ActionContext::DoRangeBoundAction(double value)
         value = rangeMinimum_;
     
     action_->Do(this, value);
+    
+    SetTrackIsDirty();
 }
 
 void ActionContext::DoSteppedValueAction(double delta)
 {
+    const vector<double> &steppedValues = GetConfig().steppedValues;
+    
     if(delta > 0)
     {
         steppedValuesIndex_++;
         
-        if(steppedValuesIndex_ > steppedValues_.size() - 1)
-            steppedValuesIndex_ = steppedValues_.size() - 1;
+        if(steppedValuesIndex_ > (int)steppedValues.size() - 1)
+            steppedValuesIndex_ = steppedValues.size() - 1;
         
-        DoRangeBoundAction(steppedValues_[steppedValuesIndex_]);
+        DoRangeBoundAction(steppedValues[steppedValuesIndex_]);
     }
     else
     {
@@ -2210,12 +2368,15 @@ void ActionContext::DoSteppedValueAction(double delta)
         if(steppedValuesIndex_ < 0 )
             steppedValuesIndex_ = 0;
         
-        DoRangeBoundAction(steppedValues_[steppedValuesIndex_]);
+        DoRangeBoundAction(steppedValues[steppedValuesIndex_]);
     }
 }
 
 void ActionContext::DoAcceleratedSteppedValueAction(int accelerationIndex, double delta)
 {
+    const vector<double> &steppedValues = GetConfig().steppedValues;
+    const vector<int> &acceleratedTickValues = GetConfig().acceleratedTickValues;
+    
     if(delta > 0)
     {
         accumulatedIncTicks_++;
@@ -2227,22 +2388,24 @@ void ActionContext::DoAcceleratedSteppedValueAction(int accelerationIndex, doubl
         accumulatedIncTicks_ = accumulatedIncTicks_ - 1 < 0 ? 0 : accumulatedIncTicks_ - 1;
     }
     
-    accelerationIndex = accelerationIndex > acceleratedTickValues_.size() - 1 ? acceleratedTickValues_.size() - 1 : accelerationIndex;
+    accelerationIndex = accelerationIndex > (int)acceleratedTickValues.size() - 1 ? (int)acceleratedTickValues.size() - 1 : accelerationIndex;
     accelerationIndex = accelerationIndex < 0 ? 0 : accelerationIndex;
     
-    if(delta > 0 && accumulatedIncTicks_ >= acceleratedTickValues_[accelerationIndex])
+    int tickCount = acceleratedTickValues.size() > 0 ? acceleratedTickValues[accelerationIndex] : 10;
+    
+    if(delta > 0 && accumulatedIncTicks_ >= tickCount)
     {
         accumulatedIncTicks_ = 0;
         accumulatedDecTicks_ = 0;
         
         steppedValuesIndex_++;
         
-        if(steppedValuesIndex_ > steppedValues_.size() - 1)
-            steppedValuesIndex_ = steppedValues_.size() - 1;
+        if(steppedValuesIndex_ > (int)steppedValues.size() - 1)
+            steppedValuesIndex_ = steppedValues.size() - 1;
         
-        DoRangeBoundAction(steppedValues_[steppedValuesIndex_]);
+        DoRangeBoundAction(steppedValues[steppedValuesIndex_]);
     }
-    else if(delta < 0 && accumulatedDecTicks_ >= acceleratedTickValues_[accelerationIndex])
+    else if(delta < 0 && accumulatedDecTicks_ >= tickCount)
     {
         accumulatedIncTicks_ = 0;
         accumulatedDecTicks_ = 0;
@@ -2252,19 +2415,21 @@ void ActionContext::DoAcceleratedSteppedValueAction(int accelerationIndex, doubl
         if(steppedValuesIndex_ < 0 )
             steppedValuesIndex_ = 0;
         
-        DoRangeBoundAction(steppedValues_[steppedValuesIndex_]);
+        DoRangeBoundAction(steppedValues[steppedValuesIndex_]);
     }
 }
 
 void ActionContext::DoAcceleratedDeltaValueAction(int accelerationIndex, double delta)
 {
-    accelerationIndex = accelerationIndex > acceleratedDeltaValues_.size() - 1 ? acceleratedDeltaValues_.size() - 1 : accelerationIndex;
+    const vector<double> &acceleratedDeltaValues = GetConfig().acceleratedDeltaValues;
+    
+    accelerationIndex = accelerationIndex > (int)acceleratedDeltaValues.size() - 1 ? (int)acceleratedDeltaValues.size() - 1 : accelerationIndex;
     accelerationIndex = accelerationIndex < 0 ? 0 : accelerationIndex;
     
     if(delta > 0.0)
-        DoRangeBoundAction(action_->GetCurrentNormalizedValue(this) + acceleratedDeltaValues_[accelerationIndex]);
+        DoRangeBoundAction(action_->GetCurrentNormalizedValue(this) + acceleratedDeltaValues[accelerationIndex]);
     else
-        DoRangeBoundAction(action_->GetCurrentNormalizedValue(this) - acceleratedDeltaValues_[accelerationIndex]);
+        DoRangeBoundAction(action_->GetCurrentNormalizedValue(this) - acceleratedDeltaValues[accelerationIndex]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2272,35 +2437,39 @@ void ActionContext::DoAcceleratedDeltaValueAction(int accelerationIndex, double
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 int Zone::GetSlotIndex()
 {
-    if(name_ == "TrackSend")
-        return zoneManager_->GetTrackSendOffset();
-    if(name_ == "TrackReceive")
-        return zoneManager_->GetTrackReceiveOffset();
-    if(name_ == "TrackFXMenu")
-        return zoneManager_->GetTrackFXMenuOffset();
-    if(name_ == "SelectedTrack")
-        return slotIndex_ + zoneManager_->GetSelectedTrackOffset();
-    if(name_ == "SelectedTrackSend")
-        return slotIndex_ + zoneManager_->GetSelectedTrackSendOffset();
-    if(name_ == "SelectedTrackReceive")
-        return slotIndex_ + zoneManager_->GetSelectedTrackReceiveOffset();
-    if(name_ == "SelectedTrackFXMenu")
-        return slotIndex_ + zoneManager_->GetSelectedTrackFXMenuOffset();
-    else return slotIndex_;
+    switch(nameSymbol_)
+    {
+        case SymbolTrackSend:
+            return zoneManager_->GetTrackSendOffset();
+        case SymbolTrackReceive:
+            return zoneManager_->GetTrackReceiveOffset();
+        case SymbolTrackFXMenu:
+            return zoneManager_->GetTrackFXMenuOffset();
+        case SymbolSelectedTrack:
+            return slotIndex_ + zoneManager_->GetSelectedTrackOffset();
+        case SymbolSelectedTrackSend:
+            return slotIndex_ + zoneManager_->GetSelectedTrackSendOffset();
+        case SymbolSelectedTrackReceive:
+            return slotIndex_ + zoneManager_->GetSelectedTrackReceiveOffset();
+        case SymbolSelectedTrackFXMenu:
+            return slotIndex_ + zoneManager_->GetSelectedTrackFXMenuOffset();
+        default:
+            return slotIndex_;
+    }
 }
 
 int Zone::GetChannelNumber()
 {
     int channelNumber = 0;
     
-    for(auto [widget, isUsed] : widgets_)
-        if(channelNumber < widget->GetChannelNumber())
-            channelNumber = widget->GetChannelNumber();
+    for(auto &widgetContexts : widgets_)
+        if(channelNumber < widgetContexts.widget->GetChannelNumber())
+            channelNumber = widgetContexts.widget->GetChannelNumber();
     
     return channelNumber;
 }
 
-Zone::Zone(ZoneManager* const zoneManager, Navigator* navigator, int slotIndex, string name, string alias, string sourceFilePath, vector<string> includedZones, vector<string> associatedZones): zoneManager_(zoneManager), navigator_(navigator), slotIndex_(slotIndex), name_(name), alias_(alias), sourceFilePath_(sourceFilePath)
+Zone::Zone(ZoneManager* const zoneManager, Navigator* navigator, int slotIndex, string name, string alias, string sourceFilePath, vector<string> includedZones, vector<string> associatedZones): zoneManager_(zoneManager), navigator_(navigator), slotIndex_(slotIndex), name_(name), nameSymbol_(InternSymbol(name)), alias_(alias), sourceFilePath_(sourceFilePath)
 {
     if(name == "Home")
     {
@@ -2325,7 +2494,7 @@ Zone::Zone(ZoneManager* const zoneManager, Navigator* navigator, int slotIndex,
                     onZoneActivation = zoneManager->GetSurface()->GetWidgetByName("OnZoneActivation");
                     onZoneDeactivation = zoneManager->GetSurface()->GetWidgetByName("OnZoneDeactivation");
                     
-                    for(auto zone : associatedZones_[zoneName])
+                    for(auto &zone : associatedZones_[zoneName])
                     {
                         if(zoneName == "VCA")
                         {
@@ -2397,8 +2566,8 @@ void Zone::GoAssociatedZone(string zoneName)
 {
     if(zoneName == "Track")
     {
-        for(auto [key, zones] : associatedZones_)
-            for(auto zone : zones)
+        for(auto &[key, zones] : associatedZones_)
+            for(auto &zone : zones)
                 zone->Deactivate();
         
         return;
@@ -2406,7 +2575,7 @@ void Zone::GoAssociatedZone(string zoneName)
     
     if(associatedZones_.count(zoneName) > 0 && associatedZones_[zoneName].size() > 0 && associatedZones_[zoneName][0]->GetIsActive())
     {
-        for(auto zone : associatedZones_[zoneName])
+        for(auto &zone : associatedZones_[zoneName])
             zone->Deactivate();
         
         zoneManager_->GoHome();
@@ -2414,12 +2583,12 @@ void Zone::GoAssociatedZone(string zoneName)
         return;
     }
     
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
             zone->Deactivate();
         
     if(associatedZones_.count(zoneName) > 0)
-        for(auto zone : associatedZones_[zoneName])
+        for(auto &zone : associatedZones_[zoneName])
             zone->Activate();
 }
 
@@ -2439,72 +2608,70 @@ void Zone::AddNavigatorsForZone(string zoneName, vector<Navigator*> &navigators)
 
 void Zone::SetXTouchDisplayColors(string color)
 {
-    for(auto [widget, isUsed] : widgets_)
-        widget->SetXTouchDisplayColors(color);
+    for(auto &widgetContexts : widgets_)
+        widgetContexts.widget->SetXTouchDisplayColors(color);
 }
 
 void Zone::RestoreXTouchDisplayColors()
 {
-    for(auto [widget, isUsed] : widgets_)
-        widget->RestoreXTouchDisplayColors();
+    for(auto &widgetContexts : widgets_)
+        widgetContexts.widget->RestoreXTouchDisplayColors();
 }
 
 void Zone::Activate()
 {
-    UpdateCurrentActionContextModifiers();
-    
-    for(auto [widget, isUsed] : widgets_)
-        if(widget->GetName() == "OnZoneActivation")
-            for(auto context : GetActionContexts(widget))
+    for(auto &widgetContexts : widgets_)
+        if(widgetContexts.widget->GetNameSymbol() == SymbolOnZoneActivation)
+            for(auto &context : GetActionContexts(widgetContexts))
                 context->DoAction(1.0);
 
     isActive_ = true;
     
     zoneManager_->GetSurface()->SendOSCMessage(GetName());
        
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
             zone->Deactivate();
     
-    for(auto [key, zones] : subZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : subZones_)
+        for(auto &zone : zones)
             zone->Deactivate();
     
-    for(auto zone : includedZones_)
+    for(auto &zone : includedZones_)
         zone->Activate();
 }
 
 void Zone::GoTrack()
 {
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
-            if(zone->GetName() == "VCA" || zone->GetName() == "Folder")
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
+            if(zone->GetNameSymbol() == SymbolVCA || zone->GetNameSymbol() == SymbolFolder)
                 zone->Deactivate();
 }
 
 void Zone::GoVCA()
 {
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
-            if(zone->GetName() == "Folder")
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
+            if(zone->GetNameSymbol() == SymbolFolder)
                 zone->Deactivate();
         
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
-            if(zone->GetName() == "VCA")
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
+            if(zone->GetNameSymbol() == SymbolVCA)
                 zone->Activate();
 }
 
 void Zone::GoFolder()
 {
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
-            if(zone->GetName() == "VCA")
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
+            if(zone->GetNameSymbol() == SymbolVCA)
                 zone->Deactivate();
     
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
-            if(zone->GetName() == "Folder")
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
+            if(zone->GetNameSymbol() == SymbolFolder)
                 zone->Activate();
 }
 
@@ -2512,76 +2679,130 @@ void Zone::OnTrackDeselection()
 {
     isActive_ = true;
     
-    for(auto zone : includedZones_)
+    for(auto &zone : includedZones_)
         zone->Activate();
    
-    for(auto [key, zones] : associatedZones_)
+    for(auto &[key, zones] : associatedZones_)
         if(key == "SelectedTrack" || key == "SelectedTrackSend" || key == "SelectedTrackReceive" || key == "SelectedTrackFXMenu")
-            for(auto zone : zones)
+            for(auto &zone : zones)
                 zone->Deactivate();
 }
 
 void Zone::Deactivate()
 {
-    for(auto [widget, isUsed] : widgets_)
-        if(widget->GetName() == "OnZoneDeactivation")
-            for(auto context : GetActionContexts(widget))
+    for(auto &widgetContexts : widgets_)
+        if(widgetContexts.widget->GetNameSymbol() == SymbolOnZoneDeactivation)
+            for(auto &context : GetActionContexts(widgetContexts))
                 context->DoAction(1.0);
 
     isActive_ = false;
     
-    for(auto zone : includedZones_)
+    for(auto &zone : includedZones_)
         zone->Deactivate();
 
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
             zone->Deactivate();
 
-    for(auto [key, zones] : subZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : subZones_)
+        for(auto &zone : zones)
             zone->Deactivate();
     
-    for(auto [widget, isUsed] : widgets_)
-        widget->Clear();
+    for(auto &widgetContexts : widgets_)
+        widgetContexts.widget->Clear();
 }
 
-void Zone::RequestUpdateWidget(Widget* widget)
+void Zone::ResetState()
 {
-    for(auto context : GetActionContexts(widget))
+    isActive_ = false;
+    slotIndex_ = 0;
+    
+    for(auto &widgetContexts : widgets_)
+        for(auto &contexts : widgetContexts.actionContexts)
+            for(auto &context : contexts)
+                context->ResetState();
+    
+    for(auto &context : defaultContexts_)
+        context->ResetState();
+    
+    for(auto &zone : includedZones_)
+        zone->ResetState();
+
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
+            zone->ResetState();
+
+    for(auto &[key, zones] : subZones_)
+        for(auto &zone : zones)
+            zone->ResetState();
+}
+
+void Zone::RequestUpdateWidget(WidgetActionContexts &widgetContexts)
+{
+    for(auto context : GetActionContexts(widgetContexts))
         context->RunDeferredActions();
     
-    for(auto context : GetActionContexts(widget))
+    // deferred actions can change the touch/toggle state, so look the contexts up again
+    vector<shared_ptr<ActionContext>> &contexts = GetActionContexts(widgetContexts);
+    
+    for(auto &context : contexts)
         context->RequestUpdateWidgetMode();
     
-    if(GetActionContexts(widget).size() > 0)
+    if(contexts.size() > 0)
+        zoneManager_->AddFeedback(contexts[0]);
+}
+
+void Zone::RequestUpdateWidget(Widget* widget, bool &isUsed)
+{
+    if(! isActive_ || isUsed)
+        return;
+    
+    // Same precedence as RequestUpdate, so the echo goes to the context that owns the Widget's feedback
+    for(auto &[key, zones] : subZones_)
+        for(auto zone : zones)
+            zone->RequestUpdateWidget(widget, isUsed);
+    
+    for(auto &[key, zones] : associatedZones_)
+        for(auto zone : zones)
+            zone->RequestUpdateWidget(widget, isUsed);
+
+    for(auto zone : includedZones_)
+        zone->RequestUpdateWidget(widget, isUsed);
+    
+    if(isUsed)
+        return;
+    
+    if(WidgetActionContexts *widgetContexts = FindWidgetActionContexts(widget))
     {
-        shared_ptr<ActionContext> context = GetActionContexts(widget)[0];
-        context->RequestUpdate();
+        isUsed = true;
+        RequestUpdateWidget(*widgetContexts);
     }
 }
 
-void Zone::RequestUpdate(map<Widget*, bool> &usedWidgets)
+void Zone::RequestUpdate(vector<bool> &usedWidgets)
 {
     if(! isActive_)
         return;
   
-    for(auto [key, zones] : subZones_)
+    for(auto &[key, zones] : subZones_)
         for(auto zone : zones)
             zone->RequestUpdate(usedWidgets);
     
-    for(auto [key, zones] : associatedZones_)
+    for(auto &[key, zones] : associatedZones_)
         for(auto zone : zones)
             zone->RequestUpdate(usedWidgets);
 
     for(auto zone : includedZones_)
         zone->RequestUpdate(usedWidgets);
     
-    for(auto [widget, value] : GetWidgets())
+    for(auto &widgetContexts : widgets_)
     {
-        if(usedWidgets[widget] == false)
+        int id = widgetContexts.widget->GetId();
+        
+        if(usedWidgets[id] == false)
         {
-            usedWidgets[widget] = true;
-            RequestUpdateWidget(widget);
+            usedWidgets[id] = true;
+            RequestUpdateWidget(widgetContexts);
         }
     }
 }
@@ -2591,27 +2812,27 @@ void Zone::DoAction(Widget* widget, bool &isUsed, double value)
     if(! isActive_ || isUsed)
         return;
     
-    for(auto [key, zones] : subZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : subZones_)
+        for(auto &zone : zones)
             zone->DoAction(widget, isUsed, value);
 
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
             zone->DoAction(widget, isUsed, value);
     
     if(isUsed)
         return;
 
-    if(widgets_.count(widget) > 0)
+    if(WidgetActionContexts *widgetContexts = FindWidgetActionContexts(widget))
     {
         isUsed = true;
         
-        for(auto context : GetActionContexts(widget))
+        for(auto &context : GetActionContexts(*widgetContexts))
             context->DoAction(value);
     }
     else
     {
-        for(auto zone : includedZones_)
+        for(auto &zone : includedZones_)
             zone->DoAction(widget, isUsed, value);
     }
 }
@@ -2621,27 +2842,27 @@ void Zone::DoRelativeAction(Widget* widget, bool &isUsed, double delta)
     if(! isActive_ || isUsed)
         return;
     
-    for(auto [key, zones] : subZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : subZones_)
+        for(auto &zone : zones)
             zone->DoRelativeAction(widget, isUsed, delta);
 
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
             zone->DoRelativeAction(widget, isUsed, delta);
 
     if(isUsed)
         return;
 
-    if(widgets_.count(widget) > 0)
+    if(WidgetActionContexts *widgetContexts = FindWidgetActionContexts(widget))
     {
         isUsed = true;
 
-        for(auto context : GetActionContexts(widget))
+        for(auto &context : GetActionContexts(*widgetContexts))
             context->DoRelativeAction(delta);
     }
     else
     {
-        for(auto zone : includedZones_)
+        for(auto &zone : includedZones_)
             zone->DoRelativeAction(widget, isUsed, delta);
     }
 }
@@ -2651,27 +2872,27 @@ void Zone::DoRelativeAction(Widget* widget, bool &isUsed, int accelerationIndex,
     if(! isActive_ || isUsed)
         return;
 
-    for(auto [key, zones] : subZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : subZones_)
+        for(auto &zone : zones)
             zone->DoRelativeAction(widget, isUsed, accelerationIndex, delta);
     
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
             zone->DoRelativeAction(widget, isUsed, accelerationIndex, delta);
 
     if(isUsed)
         return;
 
-    if(widgets_.count(widget) > 0)
+    if(WidgetActionContexts *widgetContexts = FindWidgetActionContexts(widget))
     {
         isUsed = true;
 
-        for(auto context : GetActionContexts(widget))
+        for(auto &context : GetActionContexts(*widgetContexts))
             context->DoRelativeAction(accelerationIndex, delta);
     }
     else
     {
-        for(auto zone : includedZones_)
+        for(auto &zone : includedZones_)
             zone->DoRelativeAction(widget, isUsed, accelerationIndex, delta);
     }
 }
@@ -2681,89 +2902,154 @@ void Zone::DoTouch(Widget* widget, string widgetName, bool &isUsed, double value
     if(! isActive_ || isUsed)
         return;
 
-    for(auto [key, zones] : subZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : subZones_)
+        for(auto &zone : zones)
             zone->DoTouch(widget, widgetName, isUsed, value);
     
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
+    for(auto &[key, zones] : associatedZones_)
+        for(auto &zone : zones)
             zone->DoTouch(widget, widgetName, isUsed, value);
 
     if(isUsed)
         return;
 
-    if(widgets_.count(widget) > 0)
+    if(WidgetActionContexts *widgetContexts = FindWidgetActionContexts(widget))
     {
         isUsed = true;
 
-        for(auto context : GetActionContexts(widget))
+        for(auto &context : GetActionContexts(*widgetContexts))
             context->DoTouch(value);
     }
     else
     {
-        for(auto zone : includedZones_)
+        for(auto &zone : includedZones_)
             zone->DoTouch(widget, widgetName, isUsed, value);
     }
 }
 
-void Zone::UpdateCurrentActionContextModifiers()
+void Zone::AddWidget(Widget* widget)
 {
-    for(auto [widget, isUsed] : widgets_)
-        UpdateCurrentActionContextModifier(widget);
+    if(FindWidgetActionContexts(widget) != nullptr)
+        return;
     
-    for(auto zone : includedZones_)
-        zone->UpdateCurrentActionContextModifiers();
-
-    for(auto [key, zones] : subZones_)
-        for(auto zone : zones)
-            zone->UpdateCurrentActionContextModifiers();
+    if(widget->GetId() >= (int)widgetIndices_.size())
+        widgetIndices_.resize(widget->GetId() + 1, -1);
     
-    for(auto [key, zones] : associatedZones_)
-        for(auto zone : zones)
-            zone->UpdateCurrentActionContextModifiers();
+    widgetIndices_[widget->GetId()] = widgets_.size();
+    
+    WidgetActionContexts widgetContexts;
+    widgetContexts.widget = widget;
+    widgets_.push_back(widgetContexts);
 }
 
-void Zone::UpdateCurrentActionContextModifier(Widget* widget)
+void Zone::AddActionContext(Widget* widget, int modifier, shared_ptr<ActionContext> actionContext)
 {
-    for(auto modifier : widget->GetSurface()->GetModifiers())
+    AddWidget(widget);
+    
+    WidgetActionContexts &widgetContexts = *FindWidgetActionContexts(widget);
+    
+    for(int i = 0; i < (int)widgetContexts.modifiers.size(); i++)
     {
-        if(actionContextDictionary_[widget].count(modifier) > 0)
+        if(widgetContexts.modifiers[i] == modifier)
         {
-            currentActionContextModifiers_[widget] = modifier;
-            break;
+            widgetContexts.actionContexts[i].push_back(actionContext);
+            return;
         }
     }
+    
+    widgetContexts.modifiers.push_back(modifier);
+    widgetContexts.actionContexts.push_back({ actionContext });
+    
+    BuildModifierSlots(widgetContexts);
 }
 
-vector<shared_ptr<ActionContext>> &Zone::GetActionContexts(Widget* widget)
+Zone::WidgetActionContexts *Zone::FindWidgetActionContexts(Widget* widget)
 {
-    if(currentActionContextModifiers_.count(widget) == 0)
-        UpdateCurrentActionContextModifier(widget);
-    
-    bool isTouched = false;
-    bool isToggled = false;
+    int id = widget->GetId();
     
-    if(widget->GetSurface()->GetIsChannelTouched(widget->GetChannelNumber()))
-        isTouched = true;
+    if(id >= 0 && id < (int)widgetIndices_.size() && widgetIndices_[id] >= 0)
+        return &widgets_[widgetIndices_[id]];
+    else
+        return nullptr;
+}
 
-    if(widget->GetSurface()->GetIsChannelToggled(widget->GetChannelNumber()))
-        isToggled = true;
+void Zone::BuildModifierSlots(WidgetActionContexts &widgetContexts)
+{
+    widgetContexts.modifierSlots.clear();
     
-    if(currentActionContextModifiers_.count(widget) > 0 && actionContextDictionary_.count(widget) > 0)
+    for(auto modifier : widgetContexts.modifiers)
     {
-        int modifer = currentActionContextModifiers_[widget];
+        if(modifier & 3) // Touch and Toggle variants hang off their plain modifier
+            continue;
+        
+        ModifierSlots modifierSlots;
+        modifierSlots.modifier = modifier;
         
-        if(isTouched && isToggled && actionContextDictionary_[widget].count(modifer + 3) > 0)
-            return actionContextDictionary_[widget][modifer + 3];
-        else if(isTouched && actionContextDictionary_[widget].count(modifer + 1) > 0)
-            return actionContextDictionary_[widget][modifer + 1];
-        else if(isToggled && actionContextDictionary_[widget].count(modifer + 2) > 0)
-            return actionContextDictionary_[widget][modifer + 2];
-        else if(actionContextDictionary_[widget].count(modifer) > 0)
-            return actionContextDictionary_[widget][modifer];
+        for(int offset = 0; offset < 4; offset++)
+            for(int i = 0; i < (int)widgetContexts.modifiers.size(); i++)
+                if(widgetContexts.modifiers[i] == modifier + offset)
+                    modifierSlots.slots[offset] = i;
+        
+        widgetContexts.modifierSlots.push_back(modifierSlots);
     }
+    
+    sort(widgetContexts.modifierSlots.begin(), widgetContexts.modifierSlots.end(), [](const ModifierSlots &a, const ModifierSlots &b) { return a.modifier > b.modifier; });
+    
+    widgetContexts.currentModifierValue = -1;
+}
 
-    return defaultContexts_;
+void Zone::UpdateCurrentSlots(WidgetActionContexts &widgetContexts, int modifierValue)
+{
+    widgetContexts.currentModifierValue = modifierValue;
+    
+    for(int offset = 0; offset < 4; offset++)
+        widgetContexts.currentSlots[offset] = -1;
+    
+    // The highest modifier combination made up only of engaged modifiers wins
+    for(auto &modifierSlots : widgetContexts.modifierSlots)
+    {
+        if((modifierSlots.modifier & ~modifierValue) == 0)
+        {
+            for(int offset = 0; offset < 4; offset++)
+                widgetContexts.currentSlots[offset] = modifierSlots.slots[offset];
+            
+            break;
+        }
+    }
+}
+
+vector<shared_ptr<ActionContext>> &Zone::GetActionContexts(Widget* widget)
+{
+    if(WidgetActionContexts *widgetContexts = FindWidgetActionContexts(widget))
+        return GetActionContexts(*widgetContexts);
+    else
+        return defaultContexts_;
+}
+
+vector<shared_ptr<ActionContext>> &Zone::GetActionContexts(WidgetActionContexts &widgetContexts)
+{
+    Widget* widget = widgetContexts.widget;
+    
+    int modifierValue = widget->GetSurface()->GetModifierValue();
+    
+    if(modifierValue != widgetContexts.currentModifierValue)
+        UpdateCurrentSlots(widgetContexts, modifierValue);
+    
+    bool isTouched = widget->GetSurface()->GetIsChannelTouched(widget->GetChannelNumber());
+    bool isToggled = widget->GetSurface()->GetIsChannelToggled(widget->GetChannelNumber());
+    
+    int *slots = widgetContexts.currentSlots;
+    
+    if(isTouched && isToggled && slots[3] >= 0)
+        return widgetContexts.actionContexts[slots[3]];
+    else if(isTouched && slots[1] >= 0)
+        return widgetContexts.actionContexts[slots[1]];
+    else if(isToggled && slots[2] >= 0)
+        return widgetContexts.actionContexts[slots[2]];
+    else if(slots[0] >= 0)
+        return widgetContexts.actionContexts[slots[0]];
+    else
+        return defaultContexts_;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2783,13 +3069,44 @@ ZoneManager* Widget::GetZoneManager()
     return surface_->GetZoneManager();
 }
 
-void  Widget::UpdateValue(map<string, string> &properties, double value)
+int Widget::GetFeedbackClass()
+{
+    if(feedbackClass_ != FeedbackClassUnspecified)
+        return feedbackClass_;
+    
+    // A Widget refreshes as often as its most urgent FeedbackProcessor needs, judged by the refresh rates in effect, RefreshRate included
+    Page* page = surface_->GetPage();
+    int feedbackClass = FeedbackClassUnspecified;
+    
+    for(auto feedbackProcessor : feedbackProcessors_)
+    {
+        int processorFeedbackClass = feedbackProcessor->GetFeedbackClass();
+        
+        if(processorFeedbackClass == FeedbackClassUnspecified)
+            continue;
+        
+        if(feedbackClass == FeedbackClassUnspecified)
+            feedbackClass = processorFeedbackClass;
+        else
+        {
+            double interval = page->GetFeedbackRefreshInterval(processorFeedbackClass);
+            double currentInterval = page->GetFeedbackRefreshInterval(feedbackClass);
+            
+            if(interval < currentInterval || (interval == currentInterval && processorFeedbackClass < feedbackClass))
+                feedbackClass = processorFeedbackClass;
+        }
+    }
+    
+    return feedbackClass;
+}
+
+void  Widget::UpdateValue(WidgetProperties &properties, double value)
 {
     for(auto processor : feedbackProcessors_)
         processor->SetValue(properties, value);
 }
 
-void  Widget::UpdateValue(map<string, string> &properties,string value)
+void  Widget::UpdateValue(WidgetProperties &properties, const string &value)
 {
     for(auto processor : feedbackProcessors_)
         processor->SetValue(properties, value);
@@ -2811,16 +3128,23 @@ void Widget::RestoreXTouchDisplayColors()
 {
     for(auto processor : feedbackProcessors_)
         processor->RestoreXTouchDisplayColors();
+    
+    // track colour changes were ignored while the colours were overridden, so resend them
+    surface_->SetTrackColorsAreDirty();
 }
 
 void  Widget::Clear()
 {
+    feedbackOwner_ = nullptr;
+    
     for(auto processor : feedbackProcessors_)
         processor->Clear();
 }
 
 void  Widget::ForceClear()
 {
+    feedbackOwner_ = nullptr;
+    
     for(auto processor : feedbackProcessors_)
         processor->ForceClear();
 }
@@ -2906,7 +3230,7 @@ void OSC_FeedbackProcessor::X32SetColorValue(rgba_color color)
     surface_->SendOSCMessage(this, oscAddress, surfaceColor);
 }
 
-void OSC_FeedbackProcessor::ForceValue(map<string, string> &properties, double value)
+void OSC_FeedbackProcessor::ForceValue(WidgetProperties &properties, double value)
 {
     if(DAW::GetCurrentNumberOfMilliseconds() - GetWidget()->GetLastIncomingMessageTime() < 50) // adjust the 50 millisecond value to give you smooth behaviour without making updates sluggish
         return;
@@ -2915,13 +3239,13 @@ void OSC_FeedbackProcessor::ForceValue(map<string, string> &properties, double v
     surface_->SendOSCMessage(this, oscAddress_, value);
 }
 
-void OSC_FeedbackProcessor::ForceValue(map<string, string> &properties, string value)
+void OSC_FeedbackProcessor::ForceValue(WidgetProperties &properties, string value)
 {
     lastStringValue_ = value;
     surface_->SendOSCMessage(this, oscAddress_, value);
 }
 
-void OSC_IntFeedbackProcessor::ForceValue(map<string, string> &properties, double value)
+void OSC_IntFeedbackProcessor::ForceValue(WidgetProperties &properties, double value)
 {
     lastDoubleValue_ = value;
     
@@ -2939,6 +3263,8 @@ void OSC_IntFeedbackProcessor::ForceValue(map<string, string> &properties, doubl
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 void ZoneManager::Initialize()
 {
+    fxZonePool_.clear();
+    
     PreProcessZones();
    
     if(zoneFilePaths_.count("Home") < 1)
@@ -2956,30 +3282,51 @@ void ZoneManager::Initialize()
     GoHome();
 }
 
-void ZoneManager::UpdateCurrentActionContextModifiers()
+void ZoneManager::CheckFocusedFXState()
 {
-    if(focusedFXParamZone_ != nullptr)
-        focusedFXParamZone_->UpdateCurrentActionContextModifiers();
+    if(! isFocusedFXMappingEnabled_)
+        return;
     
-    for(auto zone : focusedFXZones_)
-        zone->UpdateCurrentActionContextModifiers();
+    // Only react when the Page's focused FX watcher has seen a change since this surface last looked
+    int generation = surface_->GetPage()->GetFocusedFXGeneration();
     
-    for(auto zone : selectedTrackFXZones_)
-        zone->UpdateCurrentActionContextModifiers();
+    if(generation == focusedFXGeneration_)
+        return;
     
-    for(auto zone : fxSlotZones_)
-        zone->UpdateCurrentActionContextModifiers();
+    focusedFXGeneration_ = generation;
     
-    if(homeZone_ != nullptr)
-        homeZone_->UpdateCurrentActionContextModifiers();
+    int trackNumber = 0;
+    int itemNumber = 0;
+    int fxIndex = 0;
+    
+    int retval = surface_->GetPage()->GetFocusedFX(trackNumber, itemNumber, fxIndex);
+    
+    if((retval & 1) && (fxIndex > -1))
+    {
+        int lastRetval = -1;
+
+        if(focusedFXDictionary_.count(trackNumber) > 0 && focusedFXDictionary_[trackNumber].count(fxIndex) > 0)
+            lastRetval = focusedFXDictionary_[trackNumber][fxIndex];
+        
+        if(lastRetval != retval)
+        {
+            if(retval == 1)
+                GoFocusedFX();
+            
+            else if(retval & 4)
+                ReleaseFXZones(focusedFXZones_);
+            
+            if(focusedFXDictionary_[trackNumber].count(trackNumber) < 1)
+                focusedFXDictionary_[trackNumber] = map<int, int>();
+                               
+            focusedFXDictionary_[trackNumber][fxIndex] = retval;;
+        }
+    }
 }
 
 void ZoneManager::RequestUpdate()
 {
     CheckFocusedFXState();
-        
-    for(auto &[key, value] : usedWidgets_)
-        value = false;
     
     if(focusedFXParamZone_ != nullptr && isFocusedFXParamMappingEnabled_)
         focusedFXParamZone_->RequestUpdate(usedWidgets_);
@@ -2996,24 +3343,204 @@ void ZoneManager::RequestUpdate()
     if(homeZone_ != nullptr)
         homeZone_->RequestUpdate(usedWidgets_);
     
+    FlushHighFeedback(); // the lower classes are flushed by the Page once every surface has been walked
+    
+    // Every Widget has just been updated, nothing left to echo
+    for(auto widget : inputWidgets_)
+        hasInput_[widget->GetId()] = false;
+    
+    inputWidgets_.clear();
+    
     // default is to zero unused Widgets -- for an opposite sense device, you can override this by supplying an inverted NoAction context in the Home Zone
-    map<string, string> properties;
+    // A Widget is zeroed once, when it loses its owner, not on every pass
+    for(int i = 0; i < (int)usedWidgets_.size(); i++)
+    {
+        Widget* widget = widgets_[i];
+        
+        if(widget == nullptr)
+            continue;
+        
+        if(usedWidgets_[i])
+        {
+            widget->SetIsOwned(true);
+            usedWidgets_[i] = false; // ready for the next pass
+        }
+        else if(widget->GetIsOwned())
+        {
+            widget->SetIsOwned(false);
+            widget->Clear();
+        }
+    }
+}
+
+void ZoneManager::LoadFXZone(const string &filePath, Navigator* navigator, vector<shared_ptr<Zone>> &zones)
+{
+    vector<shared_ptr<Zone>> &pooledZones = fxZonePool_[filePath][navigator];
+    
+    if(pooledZones.size() > 0)
+    {
+        zones.push_back(pooledZones.back());
+        pooledZones.pop_back();
+    }
+    else
+    {
+        vector<Navigator*> navigators;
+        navigators.push_back(navigator);
+        
+        ProcessZoneFile(filePath, this, navigators, zones, nullptr);
+    }
+}
+
+void ZoneManager::ReleaseFXZones(vector<shared_ptr<Zone>> &zones)
+{
+    // No OnZoneDeactivation actions and no Widget clearing, an unmapped Zone is simply dropped, the Widgets nobody takes over are zeroed by RequestUpdate
+    for(auto &zone : zones)
+    {
+        zone->ResetState();
+        fxZonePool_[zone->GetSourceFilePath()][zone->GetNavigator()].push_back(zone);
+    }
+    
+    zones.clear();
+}
+
+void ZoneManager::RequestInputEchoUpdate()
+{
+    if(inputWidgets_.size() == 0)
+        return;
+    
+    for(auto widget : inputWidgets_)
+    {
+        hasInput_[widget->GetId()] = false;
+        
+        bool isUsed = false;
+        
+        if(focusedFXParamZone_ != nullptr && isFocusedFXParamMappingEnabled_)
+            focusedFXParamZone_->RequestUpdateWidget(widget, isUsed);
+        
+        for(auto zone : focusedFXZones_)
+            zone->RequestUpdateWidget(widget, isUsed);
+        
+        for(auto zone : selectedTrackFXZones_)
+            zone->RequestUpdateWidget(widget, isUsed);
+        
+        for(auto zone : fxSlotZones_)
+            zone->RequestUpdateWidget(widget, isUsed);
+        
+        if(homeZone_ != nullptr)
+            homeZone_->RequestUpdateWidget(widget, isUsed);
+    }
+    
+    inputWidgets_.clear();
+    
+    FlushHighFeedback();
+}
+
+void ZoneManager::FlushHighFeedback()
+{
+    for(auto &batch : feedbackBatches_)
+        if(batch.feedbackClass == FeedbackClassHigh && batch.contexts.size() > 0)
+        {
+            FlushFeedbackBatch(batch, 0, (int)batch.contexts.size());
+            batch.contexts.clear();
+        }
+}
+
+void ZoneManager::FlushFeedback(bool isBudgeted)
+{
+    Page* page = surface_->GetPage();
+    
+    // Lower classes refresh at their own rate, and once the cycle is over budget they go round robin, a slice per Action per cycle
+    for(auto &batch : feedbackBatches_)
+    {
+        int numContexts = (int)batch.contexts.size();
+        
+        if(batch.feedbackClass == FeedbackClassHigh || numContexts == 0)
+            continue;
+        
+        if(isBudgeted && ! page->GetIsFeedbackRefreshDue(batch.feedbackClass))
+            continue;
+        
+        if(! isBudgeted || numContexts <= FeedbackSliceSize || ! page->GetIsFeedbackOverBudget())
+        {
+            FlushFeedbackBatch(batch, 0, numContexts);
+            continue;
+        }
+        
+        int start = batch.cursor % numContexts;
+        
+        FlushFeedbackBatch(batch, start, FeedbackSliceSize);
+        
+        batch.cursor = (start + FeedbackSliceSize) % numContexts;
+        
+        int cycle = page->GetFeedbackCycle();
+        int numNewlyDeferred = 0;
+        
+        for(int i = FeedbackSliceSize; i < numContexts; i++)
+        {
+            ActionContext* context = batch.contexts[(start + i) % numContexts].get();
+            
+            if(context->GetDeferredFeedbackCycle() == 0)
+            {
+                context->SetDeferredFeedbackCycle(cycle);
+                numNewlyDeferred++;
+            }
+        }
+        
+        page->RecordDeferredFeedback(batch.feedbackClass, numContexts - FeedbackSliceSize, numNewlyDeferred);
+    }
+    
+    for(auto &batch : feedbackBatches_)
+        batch.contexts.clear();
+}
+
+void ZoneManager::FlushFeedbackBatch(FeedbackBatch &batch, int start, int count)
+{
+    Page* page = surface_->GetPage();
+    int numContexts = (int)batch.contexts.size();
+    
+    batch.dueContexts.clear();
     
-    for(auto &[key, value] : usedWidgets_)
+    for(int i = 0; i < count; i++)
     {
-        if(value == false)
+        ActionContext* context = batch.contexts[(start + i) % numContexts].get();
+        
+        if(int deferredCycle = context->GetDeferredFeedbackCycle())
         {
-            rgba_color color;
-            key->UpdateValue(properties, 0.0);
-            key->UpdateValue(properties, "");
-            key->UpdateColorValue(color);
+            page->RecordFeedbackAge(batch.feedbackClass, page->GetFeedbackCycle() - deferredCycle);
+            context->SetDeferredFeedbackCycle(0);
         }
+        
+        if(context->PrepareUpdate())
+            batch.dueContexts.push_back(context);
     }
+    
+    if(batch.dueContexts.size() > 0)
+        batch.action->RequestBatchUpdate(batch.dueContexts);
+}
+
+void ZoneManager::AddFeedback(const shared_ptr<ActionContext> &context)
+{
+    Action* action = context->GetAction();
+    int feedbackClass = context->GetFeedbackClass();
+    
+    unordered_map<Action*, int> &batchIndices = feedbackBatchIndices_[feedbackClass];
+    
+    auto it = batchIndices.find(action);
+    
+    if(it == batchIndices.end())
+    {
+        it = batchIndices.insert({ action, (int)feedbackBatches_.size() }).first;
+        feedbackBatches_.push_back(FeedbackBatch());
+        feedbackBatches_.back().action = action;
+        feedbackBatches_.back().feedbackClass = feedbackClass;
+    }
+    
+    feedbackBatches_[it->second].contexts.push_back(context);
 }
 
 void ZoneManager::GoFocusedFX()
 {
-    focusedFXZones_.clear();
+    ReleaseFXZones(focusedFXZones_);
     
     int trackNumber = 0;
     int itemNumber = 0;
@@ -3031,10 +3558,7 @@ void ZoneManager::GoFocusedFX()
         
         if(zoneFilePaths_.count(FXName) > 0)
         {
-            vector<Navigator*> navigators;
-            navigators.push_back(GetSurface()->GetPage()->GetFocusedFXNavigator());
-            
-            ProcessZoneFile(zoneFilePaths_[FXName].filePath, this, navigators, focusedFXZones_, nullptr);
+            LoadFXZone(zoneFilePaths_[FXName].filePath, GetSurface()->GetPage()->GetFocusedFXNavigator(), focusedFXZones_);
             
             for(auto zone :focusedFXZones_)
             {
@@ -3047,7 +3571,7 @@ void ZoneManager::GoFocusedFX()
 
 void ZoneManager::GoSelectedTrackFX()
 {
-    selectedTrackFXZones_.clear();
+    ReleaseFXZones(selectedTrackFXZones_);
     
     if(MediaTrack* selectedTrack = surface_->GetPage()->GetSelectedTrack())
     {
@@ -3059,10 +3583,7 @@ void ZoneManager::GoSelectedTrackFX()
             
             if(zoneFilePaths_.count(FXName) > 0)
             {
-                vector<Navigator*> navigators;
-                navigators.push_back(GetSurface()->GetPage()->GetSelectedTrackNavigator());
-                
-                ProcessZoneFile(zoneFilePaths_[FXName].filePath, this, navigators, selectedTrackFXZones_, nullptr);
+                LoadFXZone(zoneFilePaths_[FXName].filePath, GetSurface()->GetPage()->GetSelectedTrackNavigator(), selectedTrackFXZones_);
                 
                 selectedTrackFXZones_.back()->SetSlotIndex(i);
                 selectedTrackFXZones_.back()->Activate();
@@ -3073,8 +3594,8 @@ void ZoneManager::GoSelectedTrackFX()
 
 void ZoneManager::GoTrackFXSlot(MediaTrack* track, Navigator* navigator, int fxSlot)
 {
-    if((navigator->GetName() == "TrackNavigator" && broadcast_.count("TrackFXMenu") > 0) ||
-       (navigator->GetName() == "SelectedTrackNavigator" && broadcast_.count("SelectedTrackFXMenu")) > 0)
+    if((navigator->GetKind() == Navigator::NavigatorKindTrack && broadcast_.count(SymbolTrackFXMenu) > 0) ||
+       (navigator->GetKind() == Navigator::NavigatorKindSelectedTrack && broadcast_.count(SymbolSelectedTrackFXMenu) > 0))
         GetSurface()->GetPage()->SignalGoTrackFXSlot(GetSurface(), track, navigator, fxSlot);
     
     ActivateTrackFXSlot(track, navigator, fxSlot);
@@ -3088,10 +3609,7 @@ void ZoneManager::ActivateTrackFXSlot(MediaTrack* track, Navigator* navigator, i
     
     if(zoneFilePaths_.count(FXName) > 0)
     {
-        vector<Navigator*> navigators;
-        navigators.push_back(navigator);
-        
-        ProcessZoneFile(zoneFilePaths_[FXName].filePath, this, navigators, fxSlotZones_, nullptr);
+        LoadFXZone(zoneFilePaths_[FXName].filePath, navigator, fxSlotZones_);
         
         fxSlotZones_.back()->SetSlotIndex(fxSlot);
         fxSlotZones_.back()->Activate();
@@ -3252,7 +3770,7 @@ vector<double> &ZoneManager::GetSteppedValues(string zoneName, int paramNumber)
 
 void ZoneManager::HandleActivation(string zoneName)
 {
-    if(receive_.count(zoneName) > 0  && homeZone_ != nullptr)
+    if(receive_.count(InternSymbol(zoneName)) > 0  && homeZone_ != nullptr)
     {
         ClearFXMapping();
         ResetOffsets();
@@ -3268,7 +3786,7 @@ void ZoneManager::GoAssociatedZone(string associatedZoneName)
 {
     if(homeZone_ != nullptr)
     {
-        if(broadcast_.count(associatedZoneName) > 0)
+        if(broadcast_.count(InternSymbol(associatedZoneName)) > 0)
             GetSurface()->GetPage()->SignalActivation(GetSurface(), associatedZoneName);
         
         ClearFXMapping();
@@ -3282,7 +3800,7 @@ void ZoneManager::GoHome()
 {   
     string zoneName = "Home";
     
-    if(broadcast_.count(zoneName) > 0)
+    if(broadcast_.count(InternSymbol(zoneName)) > 0)
         GetSurface()->GetPage()->SignalActivation(GetSurface(), zoneName);
     
     ClearFXMapping();
@@ -3296,7 +3814,7 @@ void ZoneManager::GoHome()
 
 void ZoneManager::OnTrackSelection()
 {
-    fxSlotZones_.clear();
+    ReleaseFXZones(fxSlotZones_);
 }
 
 void ZoneManager::OnTrackDeselection()
@@ -3305,7 +3823,7 @@ void ZoneManager::OnTrackDeselection()
     {
         ResetSelectedTrackOffsets();
         
-        selectedTrackFXZones_.clear();
+        ReleaseFXZones(selectedTrackFXZones_);
         
         homeZone_->OnTrackDeselection();
     }
@@ -3313,7 +3831,7 @@ void ZoneManager::OnTrackDeselection()
 
 void ZoneManager::ToggleEnableFocusedFXMapping()
 {
-    if(broadcast_.count("ToggleEnableFocusedFXMapping") > 0)
+    if(broadcast_.count(SymbolToggleEnableFocusedFXMapping) > 0)
         GetSurface()->GetPage()->SignalToggleEnableFocusedFXMapping(GetSurface());
     
     ToggleEnableFocusedFXMappingImpl();
@@ -3321,7 +3839,7 @@ void ZoneManager::ToggleEnableFocusedFXMapping()
 
 void ZoneManager::AdjustTrackSendBank(int amount)
 {
-    if(broadcast_.count("TrackSend") > 0)
+    if(broadcast_.count(SymbolTrackSend) > 0)
         GetSurface()->GetPage()->SignalTrackSendBank(GetSurface(), amount);
     
     AdjustTrackSendOffset(amount);
@@ -3329,7 +3847,7 @@ void ZoneManager::AdjustTrackSendBank(int amount)
 
 void ZoneManager::AdjustTrackReceiveBank(int amount)
 {
-    if(broadcast_.count("TrackReceive") > 0)
+    if(broadcast_.count(SymbolTrackReceive) > 0)
         GetSurface()->GetPage()->SignalTrackReceiveBank(GetSurface(), amount);
     
     AdjustTrackReceiveOffset(amount);
@@ -3337,7 +3855,7 @@ void ZoneManager::AdjustTrackReceiveBank(int amount)
 
 void ZoneManager::AdjustTrackFXMenuBank(int amount)
 {
-    if(broadcast_.count("TrackFXMenu") > 0)
+    if(broadcast_.count(SymbolTrackFXMenu) > 0)
         GetSurface()->GetPage()->SignalTrackFXMenuBank(GetSurface(), amount);
     
     AdjustTrackFXMenuOffset(amount);
@@ -3345,7 +3863,7 @@ void ZoneManager::AdjustTrackFXMenuBank(int amount)
 
 void ZoneManager::AdjustSelectedTrackSendBank(int amount)
 {
-    if(broadcast_.count("SelectedTrackSend") > 0)
+    if(broadcast_.count(SymbolSelectedTrackSend) > 0)
         GetSurface()->GetPage()->SignalSelectedTrackSendBank(GetSurface(), amount);
     
     AdjustSelectedTrackSendOffset(amount);
@@ -3353,7 +3871,7 @@ void ZoneManager::AdjustSelectedTrackSendBank(int amount)
 
 void ZoneManager::AdjustSelectedTrackReceiveBank(int amount)
 {
-    if(broadcast_.count("SelectedTrackReceive") > 0)
+    if(broadcast_.count(SymbolSelectedTrackReceive) > 0)
         GetSurface()->GetPage()->SignalSelectedTrackReceiveBank(GetSurface(), amount);
     
     AdjustTrackReceiveOffset(amount);
@@ -3361,7 +3879,7 @@ void ZoneManager::AdjustSelectedTrackReceiveBank(int amount)
 
 void ZoneManager::AdjustSelectedTrackFXMenuBank(int amount)
 {
-    if(broadcast_.count("SelectedTrackFXMenu") > 0)
+    if(broadcast_.count(SymbolSelectedTrackFXMenu) > 0)
         GetSurface()->GetPage()->SignalSelectedTrackFXMenuBank(GetSurface(), amount);
     
     AdjustSelectedTrackFXMenuOffset(amount);
@@ -3372,6 +3890,7 @@ void ZoneManager::DoTouch(Widget* widget, double value)
     surface_->TouchChannel(widget->GetChannelNumber(), value);
     
     widget->LogInput(value);
+    AddInputWidget(widget);
     
     bool isUsed = false;
     
@@ -3411,37 +3930,11 @@ int ZoneManager::GetNumChannels() { return surface_->GetNumChannels(); }
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 void ModifierManager::RecalculateModifiers()
 {
-    if(surface_ == nullptr && page_ == nullptr)
-        return;
+    modifierValue_ = 0;
     
-    modifierCombinations_.clear();
-    modifierCombinations_.push_back(0);
-           
-    vector<int> activeModifierIndices;
-    
-    for(int i = 0; i < modifiers_.size(); i++)
-        if(modifiers_[i].isEngaged)
-            activeModifierIndices.push_back(i);
-    
-    if(activeModifierIndices.size() > 0)
-    {
-        for(auto combination : GetCombinations(activeModifierIndices))
-        {
-            int modifier = 0;
-            
-            for(int i = 0; i < combination.size(); i++)
-                modifier += modifiers_[combination[i]].value;
-
-            modifierCombinations_.push_back(modifier);
-        }
-        
-        sort(modifierCombinations_.begin(), modifierCombinations_.end(), [](const int & a, const int & b) { return a > b; });
-    }
-    
-    if(surface_ != nullptr)
-        surface_->GetZoneManager()->UpdateCurrentActionContextModifiers();
-    else if(page_ != nullptr)
-        page_->UpdateCurrentActionContextModifiers();
+    for(auto &modifier : modifiers_)
+        if(modifier.isEngaged)
+            modifierValue_ += modifier.value;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3449,17 +3942,50 @@ void ModifierManager::RecalculateModifiers()
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 void TrackNavigationManager::RebuildTracks()
 {
+    // Visibility, group and folder edits all bump the project state change count, so that, SetTrackListChange and spill toggles are the only rebuild triggers
+    int projectStateChangeCount = DAW::GetProjectStateChangeCount();
+    
+    if(projectStateChangeCount != projectStateChangeCount_)
+    {
+        projectStateChangeCount_ = projectStateChangeCount;
+        isTrackListDirty_ = true;
+    }
+    
+    if(! isTrackListDirty_)
+        return;
+    
+    isTrackListDirty_ = false;
+    isVCASpillDirty_ = true;
+    isFolderTracksDirty_ = true;
+    isSelectedTracksDirty_ = true;
+    isVCAMasksDirty_ = true;
+    isFolderTreeDirty_ = true;
+    
     int oldTracksSize = tracks_.size();
     
     tracks_.clear();
+    trackIdTracks_.clear();
+    trackIds_.clear();
+    
+    int numTracks = GetNumTracks();
     
-    for (int i = 1; i <= GetNumTracks(); i++)
+    for (int i = 1; i <= numTracks; i++)
     {
-        if(MediaTrack* track = DAW::CSurf_TrackFromID(i, followMCP_))
+        MediaTrack* track = DAW::CSurf_TrackFromID(i, followMCP_);
+        
+        trackIdTracks_.push_back(track);
+        
+        if(track != nullptr)
+        {
+            trackIds_.push_back(make_pair(track, i));
+            
             if(DAW::IsTrackVisible(track, followMCP_))
                 tracks_.push_back(track);
+        }
     }
     
+    sort(trackIds_.begin(), trackIds_.end());
+    
     if(tracks_.size() < oldTracksSize)
     {
         for(int i = oldTracksSize; i > tracks_.size(); i--)
@@ -3499,10 +4025,10 @@ void ControlSurface::Record()
 
 void ControlSurface::OnTrackSelection(MediaTrack* track)
 {
-    if(widgetsByName_.count("OnTrackSelection") > 0)
+    if(Widget* widget = hardwiredWidgets_[SymbolOnTrackSelection])
     {
         if(DAW::GetMediaTrackInfo_Value(track, "I_SELECTED"))
-            zoneManager_->DoAction(widgetsByName_["OnTrackSelection"], 1.0);
+            zoneManager_->DoAction(widget, 1.0);
         else
             zoneManager_->OnTrackDeselection();
         
@@ -3519,14 +4045,64 @@ void ControlSurface::ForceClearTrack(int trackNum)
 
 void ControlSurface::ForceUpdateTrackColors()
 {
-    for( auto processor : trackColorFeedbackProcessors_)
-        processor->ForceUpdateTrackColors();
+    UpdateTrackColors();
+    
+    areTrackColorsDirty_ = false;
+    
+    SendTrackColors();
+}
+
+// The colour message covers the whole strip and the device keeps the last one it gets, so one processor sends it for the surface
+void ControlSurface::SendTrackColors()
+{
+    for(auto it = trackColorFeedbackProcessors_.rbegin(); it != trackColorFeedbackProcessors_.rend(); ++it)
+    {
+        if((*it)->GetCanUpdateTrackColors())
+        {
+            (*it)->ForceUpdateTrackColors();
+            return;
+        }
+    }
+}
+
+void ControlSurface::UpdateTrackColors()
+{
+    if(trackColorFeedbackProcessors_.size() == 0)
+        return;
+    
+    for(int i = 0; i < numChannels_; i++)
+    {
+        MediaTrack* track = page_->GetNavigatorForChannel(i + channelOffset_)->GetTrack();
+        
+        if(track != channelTracks_[i])
+        {
+            channelTracks_[i] = track;
+            areTrackColorsDirty_ = true;
+        }
+        
+        if(track != nullptr)
+        {
+            rgba_color color = page_->GetTrackColor(track);
+            
+            if(color != channelTrackColors_[i])
+            {
+                channelTrackColors_[i] = color;
+                areTrackColorsDirty_ = true;
+            }
+        }
+    }
 }
 
 void ControlSurface::RequestUpdate()
 {
-    for( auto processor : trackColorFeedbackProcessors_)
-        processor->UpdateTrackColors();
+    UpdateTrackColors();
+    
+    if(areTrackColorsDirty_)
+    {
+        areTrackColorsDirty_ = false;
+        
+        SendTrackColors();
+    }
     
     zoneManager_->RequestUpdate();
     
@@ -3727,12 +4303,12 @@ void ControlSurface::SetScrub(bool value)
         page_->GetModifierManager()->SetScrub(value);
 }
 
-vector<int> ControlSurface::GetModifiers()
+int ControlSurface::GetModifierValue()
 {
     if(modifierManager_ != nullptr)
-        return modifierManager_->GetModifiers();
+        return modifierManager_->GetModifierValue();
     else
-        return page_->GetModifierManager()->GetModifiers();
+        return page_->GetModifierManager()->GetModifierValue();
 }
 
 void ControlSurface::ClearModifiers()
@@ -3807,21 +4383,23 @@ void Midi_ControlSurface::SendMidiMessage(MIDI_event_ex_t* midiMessage)
 {
     surfaceIO_->SendMidiMessage(midiMessage);
     
-    string output = "OUT->" + name_ + " ";
-    
-    for(int i = 0; i < midiMessage->size; i++)
+    if(TheManager->GetSurfaceOutDisplay())
     {
-        char buffer[32];
+        string output = "OUT->" + name_ + " ";
         
-        snprintf(buffer, sizeof(buffer), "%02x ", midiMessage->midi_message[i]);
+        for(int i = 0; i < midiMessage->size; i++)
+        {
+            char buffer[32];
+            
+            snprintf(buffer, sizeof(buffer), "%02x ", midiMessage->midi_message[i]);
+            
+            output += buffer;
+        }
+        
+        output += "\n";
         
-        output += buffer;
-    }
-    
-    output += "\n";
-
-    if(TheManager->GetSurfaceOutDisplay())
         DAW::ShowConsoleMsg(output.c_str());
+    }
 }
 
 void Midi_ControlSurface::SendMidiMessage(int first, int second, int third)
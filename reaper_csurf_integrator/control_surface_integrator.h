@@ -19,6 +19,8 @@
 #include <sstream>
 #include <vector>
 #include <map>
+#include <unordered_set>
+#include <unordered_map>
 #include <iomanip>
 #include <fstream>
 #include <regex>
@@ -56,16 +58,74 @@ const string SynchPagesToken = "SynchPages";
 const string UseScrollLinkToken = "UseScrollLink";
 const string MidiSurfaceToken = "MidiSurface";
 const string OSCSurfaceToken = "OSCSurface";
+const string MeterBallisticsToken = "MeterBallistics";
+const string FeedbackBudgetToken = "FeedbackBudget";
+const string IdleThrottleToken = "IdleThrottle";
+const string RefreshRateToken = "RefreshRate";
 
 const string BadFileChars = "[ \\:*?<>|.,()/]";
 const string CRLFChars = "[\r\n]";
 const string TabChars = "[\t]";
 
 const int TempDisplayTime = 1250;
+const int FeedbackSliceSize = 8; // contexts per Action per cycle once the feedback budget is spent
 
 class Manager;
 extern Manager* TheManager;
 
+// Zone and Widget names are interned to small integer ids as they load, so runtime checks compare ints, not strings
+enum Symbols
+{
+    SymbolTrack = 0,
+    SymbolVCA,
+    SymbolFolder,
+    SymbolTrackSend,
+    SymbolTrackReceive,
+    SymbolTrackFXMenu,
+    SymbolSelectedTrack,
+    SymbolSelectedTrackSend,
+    SymbolSelectedTrackReceive,
+    SymbolSelectedTrackFXMenu,
+    SymbolToggleEnableFocusedFXMapping,
+    SymbolOnTrackSelection,
+    SymbolOnPageEnter,
+    SymbolOnPageLeave,
+    SymbolOnInitialization,
+    SymbolOnPlayStart,
+    SymbolOnPlayStop,
+    SymbolOnRecordStart,
+    SymbolOnRecordStop,
+    SymbolOnZoneActivation,
+    SymbolOnZoneDeactivation,
+    NumPredefinedSymbols
+};
+
+enum FeedbackClass
+{
+    FeedbackClassUnspecified = -1,
+    FeedbackClassHigh, // never deferred
+    FeedbackClassDisplay,
+    FeedbackClassMeter,
+    FeedbackClassTime,
+    NumFeedbackClasses
+};
+
+static int GetFeedbackClassForName(const string &name) // as written in .mst, .zon and CSI.ini
+{
+    if(name == "High")
+        return FeedbackClassHigh;
+    else if(name == "Display")
+        return FeedbackClassDisplay;
+    else if(name == "Meter")
+        return FeedbackClassMeter;
+    else if(name == "Time")
+        return FeedbackClassTime;
+    else
+        return FeedbackClassUnspecified;
+}
+
+extern int InternSymbol(const string &name);
+
 static vector<string> GetTokens(string line)
 {
     vector<string> tokens;
@@ -98,6 +158,82 @@ class ZoneManager;
 class ActionContext;
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct WidgetProperties
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+    enum RingStyles
+    {
+        RingDot = 0,
+        RingBoostCut,
+        RingFill,
+        RingSpread
+    };
+    
+    enum BarStyles
+    {
+        BarNormal = 0,
+        BarBiPolar,
+        BarFill,
+        BarSpread,
+        BarOff
+    };
+    
+    enum TextAligns
+    {
+        TextCenter = 0,
+        TextLeft,
+        TextRight
+    };
+    
+    int ringStyle = RingDot;
+    int barStyle = BarOff;
+    int textAlign = TextCenter;
+    bool textInvert = false;
+    int mode = 2;
+    int feedbackClass = FeedbackClassUnspecified;
+    
+    // Compiled once, when the zone is loaded, so the feedback path only reads ints
+    void SetProperty(string key, string value)
+    {
+        if(key == "RingStyle")
+        {
+            if(value == "Dot")
+                ringStyle = RingDot;
+            else if(value == "BoostCut")
+                ringStyle = RingBoostCut;
+            else if(value == "Fill")
+                ringStyle = RingFill;
+            else if(value == "Spread")
+                ringStyle = RingSpread;
+        }
+        else if(key == "BarStyle")
+        {
+            if(value == "Normal")
+                barStyle = BarNormal;
+            else if(value == "BiPolar")
+                barStyle = BarBiPolar;
+            else if(value == "Fill")
+                barStyle = BarFill;
+            else if(value == "Spread")
+                barStyle = BarSpread;
+        }
+        else if(key == "TextAlign")
+        {
+            if(value == "Left")
+                textAlign = TextLeft;
+            else if(value == "Right")
+                textAlign = TextRight;
+        }
+        else if(key == "TextInvert")
+            textInvert = value == "Yes";
+        else if(key == "Mode")
+            mode = atoi(value.c_str());
+        else if(key == "Refresh")
+            feedbackClass = GetFeedbackClassForName(value);
+    }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class Action
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,10 +245,13 @@ public:
 
     virtual void Touch(ActionContext* context, double value) {}
     virtual void RequestUpdate(ActionContext* context) {}
+    virtual void RequestBatchUpdate(vector<ActionContext*> &contexts) { for(auto context : contexts) RequestUpdate(context); } // every context of this Action due feedback this cycle
     virtual void RequestUpdateWidgetMode(ActionContext* context) {}
     virtual void Do(ActionContext* context, double value) {}
     virtual double GetCurrentNormalizedValue(ActionContext* context) { return 0.0; }
     virtual double GetCurrentDBValue(ActionContext* context) { return 0.0; }
+    virtual bool GetIsTrackStateFeedback() { return false; } // feedback depends only on the context track's TrackState, refreshed when that track changes
+    virtual int GetFeedbackClass() { return FeedbackClassHigh; }
 
     int GetPanMode(MediaTrack* track)
     {
@@ -137,10 +276,20 @@ protected:
     bool isMCUTrackPanWidth_ = false;
 
 public:
+    enum NavigatorKind
+    {
+        NavigatorKindGeneric = 0,
+        NavigatorKindTrack,
+        NavigatorKindMasterTrack,
+        NavigatorKindSelectedTrack,
+        NavigatorKindFocusedFX
+    };
+    
     Navigator(Page*  page) : page_(page) {}
     virtual ~Navigator() {}
     
     virtual string GetName() { return "Navigator"; }
+    virtual NavigatorKind GetKind() { return NavigatorKindGeneric; }
     virtual MediaTrack* GetTrack() { return nullptr; }
 
     bool GetIsNavigatorTouched() { return isVolumeTouched_ || isPanTouched_ || isPanWidthTouched_ || isPanLeftTouched_ || isPanRightTouched_; }
@@ -176,6 +325,7 @@ public:
     virtual ~TrackNavigator() {}
     
     virtual string GetName() override { return "TrackNavigator"; }
+    virtual NavigatorKind GetKind() override { return NavigatorKindTrack; }
    
     virtual MediaTrack* GetTrack() override;
 };
@@ -189,6 +339,7 @@ public:
     virtual ~MasterTrackNavigator() {}
     
     virtual string GetName() override { return "MasterTrackNavigator"; }
+    virtual NavigatorKind GetKind() override { return NavigatorKindMasterTrack; }
     
     virtual MediaTrack* GetTrack() override;
 };
@@ -202,6 +353,7 @@ public:
     virtual ~SelectedTrackNavigator() {}
     
     virtual string GetName() override { return "SelectedTrackNavigator"; }
+    virtual NavigatorKind GetKind() override { return NavigatorKindSelectedTrack; }
     
     virtual MediaTrack* GetTrack() override;
 };
@@ -215,6 +367,7 @@ public:
     virtual ~FocusedFXNavigator() {}
     
     virtual string GetName() override { return "FocusedFXNavigator"; }
+    virtual NavigatorKind GetKind() override { return NavigatorKindFocusedFX; }
     
     virtual MediaTrack* GetTrack() override;
 };
@@ -228,27 +381,18 @@ private:
     Widget* const widget_ = nullptr;
     shared_ptr<Zone> const zone_ = nullptr;
     
-    string lastStringValue_ = "";
-    
     int intParam_ = 0;
     
-    string stringParam_ = "";
-    
     int paramIndex_ = 0;
     
-    string fxParamDisplayName_ = "";
-    
     int commandId_ = 0;
     
     double rangeMinimum_ = 0.0;
     double rangeMaximum_ = 1.0;
     
-    vector<double> steppedValues_;
     int steppedValuesIndex_ = 0;
     
     double deltaValue_ = 0.0;
-    vector<double> acceleratedDeltaValues_;
-    vector<int> acceleratedTickValues_;
     int accumulatedIncTicks_ = 0;
     int accumulatedDecTicks_ = 0;
     
@@ -261,30 +405,62 @@ private:
     int displayStyle_ = 0;
     
     bool supportsColor_ = false;
-    vector<rgba_color> colorValues_;
     int currentColorIndex_ = 0;
     
     bool supportsTrackColor_ = false;
         
     bool noFeedback_ = false;
     
-    map<string, string> widgetProperties_;
+    MediaTrack* feedbackTrack_ = nullptr;
+    int feedbackTrackGeneration_ = 0;
+    int deferredFeedbackCycle_ = 0; // first cycle its feedback was held back by the scheduler, 0 when up to date
+    int feedbackClass_ = FeedbackClassUnspecified; // resolved on first use
+    
+    WidgetProperties widgetProperties_;
+    
+    // Configuration most contexts never use, kept out of line so the fields walked every cycle stay compact
+    struct ActionContextConfig
+    {
+        string stringParam = "";
+        string fxParamDisplayName = "";
+        vector<double> steppedValues;
+        vector<double> acceleratedDeltaValues;
+        vector<int> acceleratedTickValues;
+        vector<rgba_color> colorValues;
+        vector<string> zoneNames;
+        
+        bool GetIsEmpty()
+        {
+            return stringParam == "" && fxParamDisplayName == "" && steppedValues.size() == 0 && acceleratedDeltaValues.size() == 0 && acceleratedTickValues.size() == 0 && colorValues.size() == 0 && zoneNames.size() == 0;
+        }
+    };
+    
+    unique_ptr<ActionContextConfig> config_;
     
-    vector<string> zoneNames_;
+    const ActionContextConfig &GetConfig()
+    {
+        static const ActionContextConfig emptyConfig;
+        
+        return config_ != nullptr ? *config_ : emptyConfig;
+    }
+    
+    ActionContextConfig &GetMutableConfig()
+    {
+        if(config_ == nullptr)
+            config_ = make_unique<ActionContextConfig>();
+        
+        return *config_;
+    }
     
     void UpdateTrackColor();
 
 public:
     ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zone, vector<string> params);
-    ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zone, int paramIndex) : action_(action), widget_(widget), zone_(zone), paramIndex_(paramIndex)
-    {
-        if(acceleratedTickValues_.size() < 1)
-            acceleratedTickValues_.push_back(10);
-    }
-    ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zone, string stringParam) : action_(action), widget_(widget), zone_(zone), stringParam_(stringParam)
+    ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zone, int paramIndex) : action_(action), widget_(widget), zone_(zone), paramIndex_(paramIndex) {}
+    ActionContext(Action* action, Widget* widget, shared_ptr<Zone> zone, string stringParam) : action_(action), widget_(widget), zone_(zone)
     {
-        if(acceleratedTickValues_.size() < 1)
-            acceleratedTickValues_.push_back(10);
+        if(stringParam != "")
+            GetMutableConfig().stringParam = stringParam;
     }
 
     virtual ~ActionContext() {}
@@ -292,13 +468,30 @@ public:
     Action* GetAction() { return action_; }
     Widget* GetWidget() { return widget_; }
     shared_ptr<Zone> GetZone() { return zone_; }
+    int GetFeedbackClass();
+    int GetDeferredFeedbackCycle() { return deferredFeedbackCycle_; }
+    void SetDeferredFeedbackCycle(int cycle) { deferredFeedbackCycle_ = cycle; }
+    
+    // Back to the state of a freshly built context, used when its Zone goes back into the FX Zone pool
+    void ResetState()
+    {
+        steppedValuesIndex_ = 0;
+        accumulatedIncTicks_ = 0;
+        accumulatedDecTicks_ = 0;
+        delayStartTime_ = 0.0;
+        deferredValue_ = 0.0;
+        currentColorIndex_ = 0;
+        feedbackTrack_ = nullptr;
+        feedbackTrackGeneration_ = 0;
+        deferredFeedbackCycle_ = 0;
+    }
     int GetSlotIndex();
-    string GetName();
+    const string &GetName();
     
-    vector<string> &GetZoneNames() { return  zoneNames_; }
+    const vector<string> &GetZoneNames() { return GetConfig().zoneNames; }
 
     int GetIntParam() { return intParam_; }
-    string GetStringParam() { return stringParam_; }
+    const string &GetStringParam() { return GetConfig().stringParam; }
     int GetCommandId() { return commandId_; }
     bool GetShouldUseDisplayStyle() { return shouldUseDisplayStyle_; }
     int GetDisplayStyle() { return displayStyle_; }
@@ -321,26 +514,31 @@ public:
     void DoRelativeAction(double value);
     void DoRelativeAction(int accelerationIndex, double value);
     
+    bool PrepareUpdate();
     void RequestUpdate();
     void RequestUpdateWidgetMode();
     void RunDeferredActions();
     void ClearWidget();
     void UpdateWidgetValue(double value);
-    void UpdateWidgetValue(string value);
+    void UpdateWidgetValue(const string &value);
+    void UpdateWidgetValue(const char* value);
     void UpdateColorValue(double value);
 
     void DoTouch(double value)
     {
         action_->Touch(this, value);
+        SetTrackIsDirty();
     }
+    
+    void SetTrackIsDirty();
 
-    void   SetAccelerationValues(vector<double> acceleratedDeltaValues) { acceleratedDeltaValues_ = acceleratedDeltaValues; }
+    void   SetAccelerationValues(vector<double> acceleratedDeltaValues) { GetMutableConfig().acceleratedDeltaValues = acceleratedDeltaValues; }
     void   SetStepSize(double deltaValue) { deltaValue_ = deltaValue; }
     double GetStepSize() { return deltaValue_; }
-    void   SetStepValues(vector<double> steppedValues) { steppedValues_ = steppedValues; }
-    int    GetNumberOfSteppedValues() { return steppedValues_.size(); }
-    void   SetTickCounts(vector<int> acceleratedTickValues) { acceleratedTickValues_ = acceleratedTickValues; }
-    void   SetColorValues(vector<rgba_color> colorValues) { colorValues_ = colorValues; }
+    void   SetStepValues(vector<double> steppedValues) { GetMutableConfig().steppedValues = steppedValues; }
+    int    GetNumberOfSteppedValues() { return GetConfig().steppedValues.size(); }
+    void   SetTickCounts(vector<int> acceleratedTickValues) { GetMutableConfig().acceleratedTickValues = acceleratedTickValues; }
+    void   SetColorValues(vector<rgba_color> colorValues) { GetMutableConfig().colorValues = colorValues; }
 
     double GetRangeMinimum() { return rangeMinimum_; }
     double GetRangeMaximum() { return rangeMaximum_; }
@@ -354,37 +552,30 @@ public:
         rangeMaximum_ = range[1];
     }
     
-    string GetFxParamDisplayName()
-    {
-        if(fxParamDisplayName_ != "")
-            return fxParamDisplayName_;
-        else if(MediaTrack* track = GetTrack())
-        {
-            char fxParamName[BUFSZ];
-            DAW::TrackFX_GetParamName(track, GetSlotIndex(), paramIndex_, fxParamName, sizeof(fxParamName));
-            return fxParamName;
-        }
-        
-        return "";
-    }
+    const string &GetFxParamDisplayName();
     
     void SetSteppedValueIndex(double value)
     {
+        const vector<double> &steppedValues = GetConfig().steppedValues;
+        
         int index = 0;
         double delta = 100000000.0;
         
-        for(int i = 0; i < steppedValues_.size(); i++)
-            if(abs(steppedValues_[i] - value) < delta)
+        for(int i = 0; i < (int)steppedValues.size(); i++)
+            if(abs(steppedValues[i] - value) < delta)
             {
-                delta = abs(steppedValues_[i] - value);
+                delta = abs(steppedValues[i] - value);
                 index = i;
             }
         
         steppedValuesIndex_ = index;
     }
 
-    string GetPanValueString(double panVal, string dualPan)
+    // Formatted into a shared buffer that is only valid until the next call, the value is copied straight into the widget
+    const char* GetPanValueString(double panVal, const char* dualPan)
     {
+        static char trackPanValueString[32];
+        
         bool left = false;
         
         if(panVal < 0)
@@ -394,55 +585,50 @@ public:
         }
         
         int panIntVal = int(panVal * 100.0);
-        string trackPanValueString = "";
+        
+        if(panIntVal == 0)
+        {
+            if(dualPan[0] == 'L')
+                return " L<C>  ";
+            else if(dualPan[0] == 'R')
+                return " <C>R  ";
+            else
+                return "  <C>  ";
+        }
         
         if(left)
         {
+            const char* prefix = "<  ";
+            
             if(panIntVal == 100)
-                trackPanValueString += "<";
+                prefix = "<";
             else if(panIntVal < 100 && panIntVal > 9)
-                trackPanValueString += "< ";
-            else
-                trackPanValueString += "<  ";
+                prefix = "< ";
             
-            trackPanValueString += to_string(panIntVal);
-            
-            if(dualPan != "")
-                trackPanValueString += dualPan;
+            snprintf(trackPanValueString, sizeof(trackPanValueString), "%s%d%s", prefix, panIntVal, dualPan);
         }
         else
         {
-            if(dualPan == "")
-                trackPanValueString += "   ";
-            else
-                trackPanValueString += "  " + dualPan;
-            
-            trackPanValueString += to_string(panIntVal);
+            const char* suffix = "  >";
             
             if(panIntVal == 100)
-                trackPanValueString += ">";
+                suffix = ">";
             else if(panIntVal < 100 && panIntVal > 9)
-                trackPanValueString += " >";
+                suffix = " >";
+            
+            if(dualPan[0] == 0)
+                snprintf(trackPanValueString, sizeof(trackPanValueString), "   %d%s", panIntVal, suffix);
             else
-                trackPanValueString += "  >";
-        }
-        
-        if(panIntVal == 0)
-        {
-            if(dualPan == "")
-                trackPanValueString = "  <C>  ";
-            if(dualPan == "L")
-                trackPanValueString = " L<C>  ";
-            if(dualPan == "R")
-                trackPanValueString = " <C>R  ";
-
+                snprintf(trackPanValueString, sizeof(trackPanValueString), "  %s%d%s", dualPan, panIntVal, suffix);
         }
 
         return trackPanValueString;
     }
     
-    string GetPanWidthValueString(double widthVal)
+    const char* GetPanWidthValueString(double widthVal)
     {
+        static char trackPanWidthString[32];
+        
         bool reversed = false;
         
         if(widthVal < 0)
@@ -452,17 +638,11 @@ public:
         }
         
         int widthIntVal = int(widthVal * 100.0);
-        string trackPanWidthString = "";
-        
-        if(! reversed)
-            trackPanWidthString += "Wid ";
-        else
-            trackPanWidthString += "Rev ";
-        
-        trackPanWidthString += to_string(widthIntVal);
         
         if(widthIntVal == 0)
-            trackPanWidthString = "<Mono> ";
+            return "<Mono> ";
+        
+        snprintf(trackPanWidthString, sizeof(trackPanWidthString), "%s%d", reversed ? "Rev " : "Wid ", widthIntVal);
 
         return trackPanWidthString;
     }
@@ -477,23 +657,43 @@ protected:
     Navigator* const navigator_= nullptr;
     int slotIndex_ = 0;
     string const name_ = "";
+    int const nameSymbol_ = 0;
     string const alias_ = "";
     string const sourceFilePath_ = "";
     
     bool isActive_ = false;
     
-    map<Widget*, bool> widgets_;
+    struct ModifierSlots
+    {
+        int modifier = 0;
+        int slots[4] = { -1, -1, -1, -1 }; // plain, touched, toggled, touched and toggled
+    };
+    
+    struct WidgetActionContexts
+    {
+        Widget* widget = nullptr;
+        vector<int> modifiers;
+        vector<vector<shared_ptr<ActionContext>>> actionContexts; // parallel to modifiers
+        vector<ModifierSlots> modifierSlots; // one per modifier combination, highest first
+        int currentModifierValue = -1;
+        int currentSlots[4] = { -1, -1, -1, -1 };
+    };
+    
+    vector<WidgetActionContexts> widgets_;
+    vector<int> widgetIndices_; // indexed by Widget id, -1 if the Widget is not in this Zone
     
     vector<shared_ptr<Zone>> includedZones_;
     map<string, vector<shared_ptr<Zone>>> subZones_;
     map<string, vector<shared_ptr<Zone>>> associatedZones_;
     
-    map<Widget*, map<int, vector<shared_ptr<ActionContext>>>> actionContextDictionary_;
-    map<Widget*, int> currentActionContextModifiers_;
     vector<shared_ptr<ActionContext>> defaultContexts_;
     
     void AddNavigatorsForZone(string zoneName, vector<Navigator*> &navigators);
-    void UpdateCurrentActionContextModifier(Widget* widget);
+    void BuildModifierSlots(WidgetActionContexts &widgetContexts);
+    void UpdateCurrentSlots(WidgetActionContexts &widgetContexts, int modifierValue);
+    vector<shared_ptr<ActionContext>> &GetActionContexts(WidgetActionContexts &widgetContexts);
+    
+    WidgetActionContexts *FindWidgetActionContexts(Widget* widget);
     
 public:
     Zone(ZoneManager* const zoneManager, Navigator* navigator, int slotIndex, string name, string alias, string sourceFilePath, vector<string> includedZones, vector<string> associatedZones);
@@ -505,18 +705,20 @@ public:
     void GoAssociatedZone(string associatedZoneName);
 
     Navigator* GetNavigator() { return navigator_; }
+    const string &GetSourceFilePath() { return sourceFilePath_; }
     void SetSlotIndex(int index) { slotIndex_ = index; }
     int GetSlotIndex();
     void SetXTouchDisplayColors(string color);
     void RestoreXTouchDisplayColors();
 
-    void UpdateCurrentActionContextModifiers();
     vector<shared_ptr<ActionContext>> &GetActionContexts(Widget* widget);
         
-    void RequestUpdate(map<Widget*, bool> &usedWidgets);
-    void RequestUpdateWidget(Widget* widget);
+    void RequestUpdate(vector<bool> &usedWidgets);
+    void RequestUpdateWidget(WidgetActionContexts &widgetContexts);
+    void RequestUpdateWidget(Widget* widget, bool &isUsed);
     void Activate();
     void Deactivate();
+    void ResetState();
     void GoTrack();
     void GoVCA();
     void GoFolder();
@@ -525,7 +727,6 @@ public:
     void DoRelativeAction(Widget* widget, bool &isUsed, double delta);
     void DoRelativeAction(Widget* widget, bool &isUsed, int accelerationIndex, double delta);
     void DoTouch(Widget* widget, string widgetName, bool &isUsed, double value);
-    map<Widget*, bool> &GetWidgets() { return widgets_; }
     bool GetIsActive() { return isActive_; }
     int GetChannelNumber();
     
@@ -533,8 +734,8 @@ public:
     
     bool GetIsMainZoneOnlyActive()
     {
-        for(auto [key, zones] : associatedZones_)
-            for(auto zone : zones)
+        for(auto &[key, zones] : associatedZones_)
+            for(auto &zone : zones)
                 if(zone->GetIsActive())
                     return false;
         
@@ -544,7 +745,7 @@ public:
     bool GetIsAssociatedZoneActive(string zoneName)
     {
         if(associatedZones_.count(zoneName) > 0)
-            for(auto zone : associatedZones_[zoneName])
+            for(auto &zone : associatedZones_[zoneName])
                 if(zone->GetIsActive())
                     return true;
         
@@ -559,12 +760,14 @@ public:
             Activate();
     }
 
-    string GetName()
+    const string &GetName()
     {
         return name_;
     }
     
-    string GetNameOrAlias()
+    int GetNameSymbol() { return nameSymbol_; }
+    
+    const string &GetNameOrAlias()
     {
         if(alias_ != "")
             return alias_;
@@ -572,21 +775,14 @@ public:
             return name_;
     }
     
-    void AddWidget(Widget* widget)
-    {
-        widgets_[widget] = true;
-    }
-    
-    void AddActionContext(Widget* widget, int modifier, shared_ptr<ActionContext> actionContext)
-    {
-        actionContextDictionary_[widget][modifier].push_back(actionContext);
-    }
+    void AddWidget(Widget* widget);
+    void AddActionContext(Widget* widget, int modifier, shared_ptr<ActionContext> actionContext);
     
     virtual void GoSubZone(string subZoneName)
     {
         if(subZones_.count(subZoneName) > 0)
         {
-            for(auto zone : subZones_[subZoneName])
+            for(auto &zone : subZones_[subZoneName])
             {
                 zone->SetSlotIndex(GetSlotIndex());
                 zone->Activate();
@@ -621,20 +817,26 @@ class Widget
 private:
     ControlSurface* const surface_;
     string const name_;
+    int const nameSymbol_;
     vector<FeedbackProcessor*> feedbackProcessors_;
     int channelNumber_ = 0;
     double lastIncomingMessageTime_ = 0.0;
     
     string generatorClass_ = "";
-    string feedbackClass_ = "";
+    int feedbackClass_ = FeedbackClassUnspecified; // from the .mst, otherwise its FeedbackProcessors decide
     
     bool isFXAutoMapEligible_ = false;
     
+    int id_ = -1;
+    
+    bool isOwned_ = true;
+    ActionContext* feedbackOwner_ = nullptr;
+    
     double stepSize_ = 0.0;
     vector<double> accelerationValues_;
     
 public:
-    Widget(ControlSurface* surface, string name) : surface_(surface), name_(name)
+    Widget(ControlSurface* surface, string name) : surface_(surface), name_(name), nameSymbol_(InternSymbol(name))
     {
         int index = name.length() - 1;
         if(isdigit(name[index]))
@@ -650,19 +852,29 @@ public:
     ~Widget();
     
     string GetName() { return name_; }
+    int GetNameSymbol() { return nameSymbol_; }
     ControlSurface* GetSurface() { return surface_; }
     ZoneManager* GetZoneManager();
     int GetChannelNumber() { return channelNumber_; }
     
+    void SetId(int id) { id_ = id; }
+    int GetId() { return id_; }
+    
     void SetGeneratorClass(string generatorClass) { generatorClass_ = generatorClass; }
     string GetGeneratorClass() { return generatorClass_; }
     
-    void SetFeedbackClass(string feedbackClass) { feedbackClass_ = feedbackClass; }
-    string GetFeedbackClass() { return feedbackClass_; }
+    void SetFeedbackClass(int feedbackClass) { feedbackClass_ = feedbackClass; }
+    int GetFeedbackClass();
 
     void SetIsFXAutoMapEligible() { isFXAutoMapEligible_ = true; }
     bool GetIsFXAutoMapEligible() { return isFXAutoMapEligible_; }
 
+    void SetIsOwned(bool isOwned) { isOwned_ = isOwned; }
+    bool GetIsOwned() { return isOwned_; }
+
+    void SetFeedbackOwner(ActionContext* feedbackOwner) { feedbackOwner_ = feedbackOwner; }
+    ActionContext* GetFeedbackOwner() { return feedbackOwner_; }
+
     void SetStepSize(double stepSize) { stepSize_ = stepSize; }
     double GetStepSize() { return stepSize_; }
     
@@ -672,8 +884,8 @@ public:
     void SetIncomingMessageTime(double lastIncomingMessageTime) { lastIncomingMessageTime_ = lastIncomingMessageTime; }
     double GetLastIncomingMessageTime() { return lastIncomingMessageTime_; }
     
-    void UpdateValue(map<string, string> &properties, double value);
-    void UpdateValue(map<string, string> &properties, string value);
+    void UpdateValue(WidgetProperties &properties, double value);
+    void UpdateValue(WidgetProperties &properties, const string &value);
     void UpdateColorValue(rgba_color);
     void SetXTouchDisplayColors(string color);
     void RestoreXTouchDisplayColors();
@@ -700,8 +912,8 @@ class ZoneManager
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 {
 private:
-    map<string, string> broadcast_;
-    map<string, string> receive_;
+    unordered_set<int> broadcast_; // Zone name symbols
+    unordered_set<int> receive_;
 
     ControlSurface* const surface_;
     string const zoneFolder_ = "";
@@ -712,7 +924,12 @@ private:
     map<string, CSIZoneInfo> zoneFilePaths_;
     map<string, string> stepSizeFilePaths_;
 
-    map<Widget*, bool> usedWidgets_;
+    vector<Widget*> widgets_;
+    vector<bool> usedWidgets_; // both indexed by Widget id
+    
+    // Widgets that received input since their feedback was last sent, echoed by the idle input cycle
+    vector<Widget*> inputWidgets_;
+    vector<bool> hasInput_; // indexed by Widget id
 
     shared_ptr<Zone> homeZone_ = nullptr;
     shared_ptr<Zone> firstTrackZone_ = nullptr;
@@ -721,12 +938,29 @@ private:
     bool isFocusedFXParamMappingEnabled_ = false;
 
     map<int, map<int, int>> focusedFXDictionary_;
+    int focusedFXGeneration_ = 0;
     vector<shared_ptr<Zone>> focusedFXZones_;
     bool isFocusedFXMappingEnabled_ = true;
     
     vector<shared_ptr<Zone>> selectedTrackFXZones_;
     vector<shared_ptr<Zone>> fxSlotZones_;
     
+    // FX Zones that have been unmapped, by Zone file and Navigator, ready to be mapped again without rebuilding them
+    map<string, map<Navigator*, vector<shared_ptr<Zone>>>> fxZonePool_;
+    
+    struct FeedbackBatch
+    {
+        Action* action = nullptr;
+        int feedbackClass = FeedbackClassHigh;
+        int cursor = 0; // where the next round robin slice starts when over budget
+        vector<shared_ptr<ActionContext>> contexts; // shared, a deferred action or track list change can drop the Zone mid cycle
+        vector<ActionContext*> dueContexts; // kept alive by contexts until the batch is flushed
+    };
+    
+    // Feedback due this pass, grouped by Action, storage kept between passes
+    vector<FeedbackBatch> feedbackBatches_;
+    unordered_map<Action*, int> feedbackBatchIndices_[NumFeedbackClasses];
+    
     map <string, map<int, vector<double>>> steppedValues_;
     vector<double> emptySteppedValues;
 
@@ -739,6 +973,10 @@ private:
     int selectedTrackFXMenuOffset_ = 0;
 
     void CalculateAndWriteSteppedValues(string zoneName);
+    void FlushHighFeedback();
+    void FlushFeedbackBatch(FeedbackBatch &batch, int start, int count);
+    void LoadFXZone(const string &filePath, Navigator* navigator, vector<shared_ptr<Zone>> &zones);
+    void ReleaseFXZones(vector<shared_ptr<Zone>> &zones);
 
     void ResetOffsets()
     {
@@ -758,6 +996,17 @@ private:
         selectedTrackReceiveOffset_ = 0;
         selectedTrackFXMenuOffset_ = 0;
     }
+    
+    void AddInputWidget(Widget* widget)
+    {
+        int id = widget->GetId();
+        
+        if(id < 0 || id >= (int)hasInput_.size() || hasInput_[id])
+            return;
+        
+        hasInput_[id] = true;
+        inputWidgets_.push_back(widget);
+    }
        
 public:
     ZoneManager(ControlSurface* surface, string zoneFolder, bool shouldProcessAutoStepSizes) : surface_(surface), zoneFolder_(zoneFolder), shouldProcessAutoStepSizes_(shouldProcessAutoStepSizes)
@@ -772,7 +1021,10 @@ public:
     void Initialize();
 
     void RequestUpdate();
-    void UpdateCurrentActionContextModifiers();
+    void RequestInputEchoUpdate();
+    void FlushFeedback(bool isBudgeted);
+    void AddFeedback(const shared_ptr<ActionContext> &context);
+    bool GetHasInput() { return inputWidgets_.size() > 0; }
     
     void PreProcessZones();
     
@@ -865,57 +1117,59 @@ public:
     
     void ClearFXMapping()
     {
-        focusedFXZones_.clear();
-        selectedTrackFXZones_.clear();
-        fxSlotZones_.clear();
+        ReleaseFXZones(focusedFXZones_);
+        ReleaseFXZones(selectedTrackFXZones_);
+        ReleaseFXZones(fxSlotZones_);
     }
     
+    void ClearFXZonePool() { fxZonePool_.clear(); }
+    
     void HandleGoTrackFXSlot(MediaTrack* track, Navigator* navigator, int fxSlot)
     {
-        if((navigator->GetName() == "TrackNavigator" && receive_.count("TrackFXMenu") > 0) ||
-           (navigator->GetName() == "SelectedTrackNavigator" && receive_.count("SelectedTrackFXMenu")) > 0)
+        if((navigator->GetKind() == Navigator::NavigatorKindTrack && receive_.count(SymbolTrackFXMenu) > 0) ||
+           (navigator->GetKind() == Navigator::NavigatorKindSelectedTrack && receive_.count(SymbolSelectedTrackFXMenu) > 0))
             ActivateTrackFXSlot(track, navigator, fxSlot);
     }
     
     void HandleToggleEnableFocusedFXMapping()
     {
-        if(receive_.count("ToggleEnableFocusedFXMapping") > 0)
+        if(receive_.count(SymbolToggleEnableFocusedFXMapping) > 0)
             ToggleEnableFocusedFXMappingImpl();
     }
 
     void HandleTrackSendBank(int amount)
     {
-        if(receive_.count("TrackSend") > 0)
+        if(receive_.count(SymbolTrackSend) > 0)
             AdjustTrackSendOffset(amount);
     }
 
     void HandleTrackReceiveBank(int amount)
     {
-        if(receive_.count("TrackReceive") > 0)
+        if(receive_.count(SymbolTrackReceive) > 0)
             AdjustTrackReceiveOffset(amount);
     }
 
     void HandleTrackFXMenuBank(int amount)
     {
-        if(receive_.count("TrackFXMenu") > 0)
+        if(receive_.count(SymbolTrackFXMenu) > 0)
             AdjustTrackFXMenuOffset(amount);
     }
     
     void HandleSelectedTrackSendBank(int amount)
     {
-        if(receive_.count("SelectedTrackSend") > 0)
+        if(receive_.count(SymbolSelectedTrackSend) > 0)
             AdjustTrackSendOffset(amount);
     }
 
     void HandleSelectedTrackReceiveBank(int amount)
     {
-        if(receive_.count("SelectedTrackReceive") > 0)
+        if(receive_.count(SymbolSelectedTrackReceive) > 0)
             AdjustTrackReceiveOffset(amount);
     }
 
     void HandleSelectedTrackFXMenuBank(int amount)
     {
-        if(receive_.count("SelectedTrackFXMenu") > 0)
+        if(receive_.count(SymbolSelectedTrackFXMenu) > 0)
             AdjustTrackFXMenuOffset(amount);
     }
     
@@ -991,27 +1245,36 @@ public:
         
     void AddWidget(Widget* widget)
     {
-        usedWidgets_[widget] = false;
+        if(widget->GetId() >= (int)widgets_.size())
+        {
+            widgets_.resize(widget->GetId() + 1, nullptr);
+            usedWidgets_.resize(widget->GetId() + 1, false);
+            hasInput_.resize(widget->GetId() + 1, false);
+        }
+        
+        widgets_[widget->GetId()] = widget;
     }
 
     void SetBroadcast(ActionContext* context)
     {
         for(string param : context->GetZoneNames())
-            broadcast_[param] = param;
+            broadcast_.insert(InternSymbol(param));
     }
 
     void SetReceive(ActionContext* context)
     {
         for(string param : context->GetZoneNames())
-            receive_[param] = param;
+            receive_.insert(InternSymbol(param));
     }
 
-    string GetName(string name)
+    const string &GetName(const string &name)
     {
+        static const string noMap = "No Map";
+        
         if(zoneFilePaths_.count(name) > 0)
             return zoneFilePaths_[name].alias;
         else
-            return "No Map";
+            return noMap;
     }
     
     void AddZoneFilePath(string name, struct CSIZoneInfo info)
@@ -1026,43 +1289,12 @@ public:
             stepSizeFilePaths_[name] = filename;
     }
     
-    void CheckFocusedFXState()
-    {
-        if(! isFocusedFXMappingEnabled_)
-            return;
-        
-        int trackNumber = 0;
-        int itemNumber = 0;
-        int fxIndex = 0;
-        
-        int retval = DAW::GetFocusedFX2(&trackNumber, &itemNumber, &fxIndex);
-        
-        if((retval & 1) && (fxIndex > -1))
-        {
-            int lastRetval = -1;
-
-            if(focusedFXDictionary_.count(trackNumber) > 0 && focusedFXDictionary_[trackNumber].count(fxIndex) > 0)
-                lastRetval = focusedFXDictionary_[trackNumber][fxIndex];
-            
-            if(lastRetval != retval)
-            {
-                if(retval == 1)
-                    GoFocusedFX();
-                
-                else if(retval & 4)
-                    focusedFXZones_.clear();
-                
-                if(focusedFXDictionary_[trackNumber].count(trackNumber) < 1)
-                    focusedFXDictionary_[trackNumber] = map<int, int>();
-                                   
-                focusedFXDictionary_[trackNumber][fxIndex] = retval;;
-            }
-        }
-    }
+    void CheckFocusedFXState();
        
     void DoAction(Widget* widget, double value)
     {
         widget->LogInput(value);
+        AddInputWidget(widget);
         
         bool isUsed = false;
         
@@ -1094,6 +1326,7 @@ public:
     void DoRelativeAction(Widget* widget, double delta)
     {
         widget->LogInput(delta);
+        AddInputWidget(widget);
         
         bool isUsed = false;
         
@@ -1125,6 +1358,7 @@ public:
     void DoRelativeAction(Widget* widget, int accelerationIndex, double delta)
     {
         widget->LogInput(delta);
+        AddInputWidget(widget);
         
         bool isUsed = false;
            
@@ -1245,32 +1479,11 @@ private:
     };
 
     vector<Modifier> modifiers_;
-    vector<int> modifierCombinations_;
-    
-    vector<vector<int>> GetCombinations(vector<int> &indices)
-    {
-        vector<vector<int>> combinations;
-        
-        for (int mask = 0; mask < (1 << indices.size()); mask++)
-        {
-            vector<int> combination; // Stores a combination
-            
-            for (int position = 0; position < indices.size(); position++)
-                if (mask & (1 << position))
-                    combination.push_back(indices[position]);
-            
-            if(combination.size() > 0)
-                combinations.push_back(combination);
-        }
-        
-        return combinations;
-    }
+    int modifierValue_ = 0;
 
 public:
     ModifierManager()
     {
-        modifierCombinations_.push_back(0);
-        
         for(int i = 0; i < 10; i++)
             modifiers_.push_back(Modifier());
         
@@ -1291,7 +1504,6 @@ public:
     }
     
     void RecalculateModifiers();
-    vector<int> GetModifiers() { return modifierCombinations_; }
     
     bool GetShift() { return modifiers_[Shift].isEngaged; }
     bool GetOption() { return modifiers_[Option].isEngaged; }
@@ -1304,16 +1516,7 @@ public:
     bool GetZoom() { return modifiers_[Zoom].isEngaged; }
     bool GetScrub() { return modifiers_[Scrub].isEngaged; }
 
-    int GetModifierValue()
-    {
-        int modifierValue = 0;
-        
-        for(auto modifier : modifiers_)
-            if(modifier.isEngaged)
-                modifierValue += modifier.value;
-        
-        return modifierValue;
-    }
+    int GetModifierValue() { return modifierValue_; }
     
     void SetShift(bool value)
     {
@@ -1422,6 +1625,12 @@ private:
     bool isFastForwarding_ = false;
     
     vector<FeedbackProcessor*> trackColorFeedbackProcessors_;
+    vector<MediaTrack*> channelTracks_;
+    vector<rgba_color> channelTrackColors_;
+    bool areTrackColorsDirty_ = true;
+    
+    void UpdateTrackColors();
+    void SendTrackColors();
 
     map<int, bool> channelTouches_;
     map<int, bool> channelToggles_;
@@ -1440,6 +1649,9 @@ protected:
             channelTouches_[i] = false;
             channelToggles_[i] = false;
         }
+        
+        channelTracks_.resize(numChannels, nullptr);
+        channelTrackColors_.resize(numChannels);
     }
 
     Page* const page_;
@@ -1451,6 +1663,7 @@ protected:
     
     vector<Widget*> widgets_;
     map<string, Widget*> widgetsByName_;
+    Widget* hardwiredWidgets_[NumPredefinedSymbols] = {}; // by name symbol, OnPlayStart etc.
     
     map<string, CSIMessageGenerator*> CSIMessageGeneratorsByMessage_;
     
@@ -1518,6 +1731,7 @@ public:
     virtual void RequestUpdate();
     void ForceClearTrack(int trackNum);
     void ForceUpdateTrackColors();
+    void SetTrackColorsAreDirty() { areTrackColorsDirty_ = true; }
     void OnTrackSelection(MediaTrack* track);
     virtual void SetHasMCUMeters(int displayType) {}
     virtual void SendOSCMessage(string zoneName) {}
@@ -1526,6 +1740,8 @@ public:
     virtual void SendOSCMessage(string zoneName, string value) {}
 
     virtual void HandleExternalInput() {}
+    void RequestInputEchoUpdate() { zoneManager_->RequestInputEchoUpdate(); }
+    void FlushFeedback(bool isBudgeted) { zoneManager_->FlushFeedback(isBudgeted); }
     virtual void UpdateTimeDisplay() {}
     virtual void ForceRefreshTimeDisplay() {}
     
@@ -1539,6 +1755,10 @@ public:
     int GetNumChannels() { return numChannels_; }
     int GetChannelOffset() { return channelOffset_; }
     
+    // Snapshot of the tracks and colors under this surface's channels, refreshed once per cycle
+    MediaTrack* GetChannelTrack(int channel) { return channelTracks_[channel]; }
+    rgba_color GetChannelTrackColor(int channel) { return channelTrackColors_[channel]; }
+    
     bool GetIsRewinding() { return isRewinding_; }
     bool GetIsFastForwarding() { return isFastForwarding_; }
 
@@ -1588,23 +1808,23 @@ public:
     
     void HandleStop()
     {
-        if(widgetsByName_.count("OnRecordStop") > 0)
-            zoneManager_->DoAction(widgetsByName_["OnRecordStop"], 1.0);
+        if(Widget* widget = hardwiredWidgets_[SymbolOnRecordStop])
+            zoneManager_->DoAction(widget, 1.0);
 
-        if(widgetsByName_.count("OnPlayStop") > 0)
-            zoneManager_->DoAction(widgetsByName_["OnPlayStop"], 1.0);
+        if(Widget* widget = hardwiredWidgets_[SymbolOnPlayStop])
+            zoneManager_->DoAction(widget, 1.0);
     }
     
     void HandlePlay()
     {
-        if(widgetsByName_.count("OnPlayStart") > 0)
-            zoneManager_->DoAction(widgetsByName_["OnPlayStart"], 1.0);
+        if(Widget* widget = hardwiredWidgets_[SymbolOnPlayStart])
+            zoneManager_->DoAction(widget, 1.0);
     }
     
     void HandleRecord()
     {
-        if(widgetsByName_.count("OnRecordStart") > 0)
-            zoneManager_->DoAction(widgetsByName_["OnRecordStart"], 1.0);
+        if(Widget* widget = hardwiredWidgets_[SymbolOnRecordStart])
+            zoneManager_->DoAction(widget, 1.0);
     }
         
     void StartRewinding()
@@ -1653,8 +1873,12 @@ public:
            
     void AddWidget(Widget* widget)
     {
+        widget->SetId(widgets_.size());
         widgets_.push_back(widget);
         widgetsByName_[widget->GetName()] = widget;
+        
+        if(widget->GetNameSymbol() < NumPredefinedSymbols)
+            hardwiredWidgets_[widget->GetNameSymbol()] = widget;
         zoneManager_->AddWidget(widget);
     }
     
@@ -1675,22 +1899,22 @@ public:
     {
         ForceClear();
         
-        if(widgetsByName_.count("OnPageEnter") > 0)
-            zoneManager_->DoAction(widgetsByName_["OnPageEnter"], 1.0);
+        if(Widget* widget = hardwiredWidgets_[SymbolOnPageEnter])
+            zoneManager_->DoAction(widget, 1.0);
     }
     
     void OnPageLeave()
     {
         ForceClear();
         
-        if(widgetsByName_.count("OnPageLeave") > 0)
-            zoneManager_->DoAction(widgetsByName_["OnPageLeave"], 1.0);
+        if(Widget* widget = hardwiredWidgets_[SymbolOnPageLeave])
+            zoneManager_->DoAction(widget, 1.0);
     }
     
     void OnInitialization()
     {
-        if(widgetsByName_.count("OnInitialization") > 0)
-            zoneManager_->DoAction(widgetsByName_["OnInitialization"], 1.0);
+        if(Widget* widget = hardwiredWidgets_[SymbolOnInitialization])
+            zoneManager_->DoAction(widget, 1.0);
     }
     
     
@@ -1716,14 +1940,8 @@ public:
     void SetZoom(bool value);
     void SetScrub(bool value);
     
-    vector<int> GetModifiers();
+    int GetModifierValue();
     void ClearModifiers();
-    
-    void UpdateCurrentActionContextModifiers()
-    {
-        if(modifierManager_ == nullptr)
-            GetZoneManager()->UpdateCurrentActionContextModifiers();
-    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1743,19 +1961,20 @@ public:
     virtual string GetName()  { return "FeedbackProcessor"; }
     Widget* GetWidget() { return widget_; }
     virtual void SetColorValue(rgba_color color) {}
-    virtual void ForceValue(map<string, string> &properties, double value) {}
+    virtual void ForceValue(WidgetProperties &properties, double value) {}
     virtual void ForceColorValue(rgba_color color) {}
-    virtual void ForceValue(map<string, string> &properties, string value) {}
+    virtual void ForceValue(WidgetProperties &properties, string value) {}
     virtual void SetColors(rgba_color textColor, rgba_color textBackground) {}
     virtual void SetCurrentColor(double value) {}
-    virtual void UpdateTrackColors() {}
     virtual void ForceUpdateTrackColors() {}
+    virtual bool GetCanUpdateTrackColors() { return false; }
     virtual void SetXTouchDisplayColors(string color) {}
     virtual void RestoreXTouchDisplayColors() {}
 
     virtual int GetMaxCharacters() { return 0; }
+    virtual int GetFeedbackClass() { return FeedbackClassUnspecified; } // leaves it to the Action
 
-    virtual void SetValue(map<string, string> &properties, double value)
+    virtual void SetValue(WidgetProperties &properties, double value)
     {
         if(lastDoubleValue_ != value)
         {
@@ -1764,7 +1983,7 @@ public:
         }
     }
     
-    virtual void SetValue(map<string, string> &properties, string value)
+    virtual void SetValue(WidgetProperties &properties, const string &value)
     {
         if(lastStringValue_ != value)
         {
@@ -1781,7 +2000,7 @@ public:
     
     void Clear()
     {
-        map<string, string> properties;
+        WidgetProperties properties;
         
         rgba_color color;
         SetValue(properties, 0.0);
@@ -1791,7 +2010,7 @@ public:
     
     void ForceClear()
     {
-        map<string, string> properties;
+        WidgetProperties properties;
         rgba_color color;
         ForceValue(properties, 0.0);
         ForceValue(properties, "");
@@ -1943,8 +2162,8 @@ public:
 
     virtual void SetColorValue(rgba_color color) override;
     virtual void X32SetColorValue(rgba_color color);
-    virtual void ForceValue(map<string, string> &properties, double value) override;
-    virtual void ForceValue(map<string, string> &properties, string value) override;
+    virtual void ForceValue(WidgetProperties &properties, double value) override;
+    virtual void ForceValue(WidgetProperties &properties, string value) override;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1957,7 +2176,7 @@ public:
 
     virtual string GetName() override { return "OSC_IntFeedbackProcessor"; }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override;
+    virtual void ForceValue(WidgetProperties &properties, double value) override;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2095,8 +2314,21 @@ private:
     int trackOffset_ = 0;
     int vcaTrackOffset_ = 0;
     int folderTrackOffset_ = 0;
+    int projectStateChangeCount_ = -1;
+    bool isTrackListDirty_ = true;
+    bool isVCASpillDirty_ = true;
+    bool isFolderTracksDirty_ = true;
     vector<MediaTrack*> tracks_;
+    vector<MediaTrack*> trackIdTracks_; // trackIdTracks_[id - 1] == CSurf_TrackFromID(id, followMCP_)
+    vector<pair<MediaTrack*, int>> trackIds_; // sorted by track, a rebuild reuses the capacity instead of reallocating hash nodes
+    
+    // Groups 1-32 in the low word, 33-64 in the high word, parallel to trackIdTracks_
+    vector<uint64_t> vcaLeaderMasks_;
+    vector<uint64_t> vcaFollowerMasks_;
+    bool isVCAMasksDirty_ = true;
     vector<MediaTrack*> selectedTracks_;
+    vector<MediaTrack*> sortedSelectedTracks_;
+    bool isSelectedTracksDirty_ = true;
     
     vector<MediaTrack*> vcaTopLeadTracks_;
     MediaTrack*         vcaLeadTrack_ = nullptr;
@@ -2107,7 +2339,14 @@ private:
     MediaTrack*         folderParentTrack_ = nullptr;
     vector<MediaTrack*> folderParentTracks_;
     vector<MediaTrack*> folderSpillTracks_;
-    map<MediaTrack*,    vector<MediaTrack*>> folderDictionary_;
+    
+    // Flat folder tree parallel to trackIdTracks_, -1 where there is no such track
+    vector<int> folderDepths_;
+    vector<int> folderFirstChildren_;
+    vector<int> folderNextSiblings_;
+    vector<int> folderLastChildren_;
+    vector<int> openFolders_;
+    bool isFolderTreeDirty_ = true;
 
     map<int, Navigator*> trackNavigators_;
     Navigator* const masterTrackNavigator_ = nullptr;
@@ -2128,12 +2367,10 @@ private:
                 if(selectedTrack == navigator->GetTrack())
                     return;
             
-            for(int i = 1; i <= GetNumTracks(); i++)
-                if(selectedTrack == GetTrackFromId(i))
-                {
-                    trackOffset_ = i - 1;
-                    break;
-                }
+            int id = GetIdFromTrack(selectedTrack);
+            
+            if(id > 0)
+                trackOffset_ = id - 1;
             
             trackOffset_ -= targetScrollLinkChannel_;
             
@@ -2193,11 +2430,13 @@ public:
     void VCAModeActivated()
     {
         currentTrackVCAFolderMode_ = 1;
+        isVCASpillDirty_ = true;
     }
     
     void FolderModeActivated()
     {
         currentTrackVCAFolderMode_ = 2;
+        isFolderTracksDirty_ = true;
     }
     
     void VCAModeDeactivated()
@@ -2224,24 +2463,24 @@ public:
             return "";
     }
 
-    string GetAutoModeDisplayName(int modeIndex)
+    const char* GetAutoModeDisplayName(int modeIndex)
     {
         int globalOverride = DAW::GetGlobalAutomationOverride();
 
         if(globalOverride > -1) // -1=no override, 0=trim/read, 1=read, 2=touch, 3=write, 4=latch, 5=bypass
-            return autoModeDisplayNames__[globalOverride];
+            return autoModeDisplayNames__[globalOverride].c_str();
         else
-            return autoModeDisplayNames__[modeIndex];
+            return autoModeDisplayNames__[modeIndex].c_str();
     }
 
-    string GetGlobalAutoModeDisplayName()
+    const char* GetGlobalAutoModeDisplayName()
     {
         int globalOverride = DAW::GetGlobalAutomationOverride();
 
         if(globalOverride == -1)
             return "NoOverride";
         else if(globalOverride > -1) // -1=no override, 0=trim/read, 1=read, 2=touch, 3=write, 4=latch, 5=bypass
-            return autoModeDisplayNames__[globalOverride];
+            return autoModeDisplayNames__[globalOverride].c_str();
         else
             return "";
     }
@@ -2284,14 +2523,8 @@ public:
         DAW::GetSetMediaTrackInfo(track, "I_RECMONITEMS", &recMonitorItemMode);
     }
     
-    string GetCurrentInputMonitorMode(MediaTrack* track)
+    const char* GetInputMonitorModeDisplayName(int recMonitorMode, int recMonitorItemMode)
     {
-        // I_RECMON : int * : record monitor (0=off, 1=normal, 2=not when playing (tapestyle))
-        int recMonitorMode = DAW::GetMediaTrackInfo_Value(track,"I_RECMON");
-
-        // I_RECMONITEMS : int * : monitor items while recording (0=off, 1=on)
-        int recMonitorItemMode = DAW::GetMediaTrackInfo_Value(track,"I_RECMONITEMS");
-
         if(recMonitorMode == 0)
             return "Off";
         else if(recMonitorMode == 1 && recMonitorItemMode == 0)
@@ -2306,15 +2539,42 @@ public:
             return "";
     }
     
+    // Rebuilt only after a selection notification or track list rebuild, the containers keep their capacity between rebuilds
     vector<MediaTrack*> &GetSelectedTracks()
     {
-        selectedTracks_.clear();
-        
-        for(int i = 0; i < DAW::CountSelectedTracks(); i++)
-            selectedTracks_.push_back(DAW::GetSelectedTrack(i));
+        if(isSelectedTracksDirty_)
+        {
+            isSelectedTracksDirty_ = false;
+            
+            selectedTracks_.clear();
+            sortedSelectedTracks_.clear();
+            
+            int numSelectedTracks = DAW::CountSelectedTracks();
+            
+            for(int i = 0; i < numSelectedTracks; i++)
+            {
+                MediaTrack* track = DAW::GetSelectedTrack(i);
+                selectedTracks_.push_back(track);
+                sortedSelectedTracks_.push_back(track);
+            }
+            
+            sort(sortedSelectedTracks_.begin(), sortedSelectedTracks_.end());
+        }
         
         return selectedTracks_;
     }
+    
+    bool GetIsTrackSelected(MediaTrack* track)
+    {
+        GetSelectedTracks();
+        
+        return binary_search(sortedSelectedTracks_.begin(), sortedSelectedTracks_.end(), track);
+    }
+    
+    void OnTrackSelectionChange()
+    {
+        isSelectedTracksDirty_ = true;
+    }
 
     void AdjustTrackBank(int amount)
     {
@@ -2448,22 +2708,100 @@ public:
         return nullptr;
     }
     
+    // The index is only trusted while the track list is clean, between a change notification and the next rebuild Reaper is asked directly
+    bool GetIsTrackIndexValid()
+    {
+        return ! isTrackListDirty_ && (int)trackIdTracks_.size() == GetNumTracks();
+    }
+    
+    // 0 when the track is not in the index
+    int FindTrackId(MediaTrack* track)
+    {
+        auto it = lower_bound(trackIds_.begin(), trackIds_.end(), make_pair(track, 0));
+        
+        if(it != trackIds_.end() && it->first == track)
+            return it->second;
+        
+        return 0;
+    }
+    
     MediaTrack* GetTrackFromId(int trackNumber)
     {
-        if(trackNumber <= GetNumTracks())
-            return DAW::CSurf_TrackFromID(trackNumber, followMCP_);
+        if(! GetIsTrackIndexValid())
+        {
+            if(trackNumber <= GetNumTracks())
+                return DAW::CSurf_TrackFromID(trackNumber, followMCP_);
+            else
+                return nullptr;
+        }
+        
+        if(trackNumber >= 1 && trackNumber <= (int)trackIdTracks_.size())
+            return trackIdTracks_[trackNumber - 1];
+        else if(trackNumber == 0)
+            return DAW::CSurf_TrackFromID(0, followMCP_);
         else
             return nullptr;
     }
     
     int GetIdFromTrack(MediaTrack* track)
     {
-        return DAW::CSurf_TrackToID(track, followMCP_);
+        if(! GetIsTrackIndexValid())
+            return DAW::CSurf_TrackToID(track, followMCP_);
+        
+        int id = FindTrackId(track);
+        
+        if(id != 0)
+            return id;
+        else
+            return DAW::CSurf_TrackToID(track, followMCP_);
+    }
+    
+    uint64_t GetVCAGroupMask(MediaTrack* track, const char* groupName)
+    {
+        return (uint64_t)DAW::GetTrackGroupMembership(track, groupName) | ((uint64_t)DAW::GetTrackGroupMembershipHigh(track, groupName) << 32);
+    }
+    
+    void UpdateVCAMasks()
+    {
+        if(! isVCAMasksDirty_)
+            return;
+        
+        isVCAMasksDirty_ = false;
+        
+        vcaLeaderMasks_.resize(trackIdTracks_.size());
+        vcaFollowerMasks_.resize(trackIdTracks_.size());
+        
+        for(int i = 0; i < (int)trackIdTracks_.size(); i++)
+        {
+            vcaLeaderMasks_[i] = GetVCAGroupMask(trackIdTracks_[i], "VOLUME_VCA_LEAD");
+            vcaFollowerMasks_[i] = GetVCAGroupMask(trackIdTracks_[i], "VOLUME_VCA_FOLLOW");
+        }
+    }
+    
+    uint64_t GetVCALeaderMask(MediaTrack* track)
+    {
+        if(GetIsTrackIndexValid())
+        {
+            int id = FindTrackId(track);
+            
+            if(id != 0)
+            {
+                UpdateVCAMasks();
+                return vcaLeaderMasks_[id - 1];
+            }
+        }
+        
+        return GetVCAGroupMask(track, "VOLUME_VCA_LEAD");
+    }
+    
+    bool GetIsVCALeader(MediaTrack* track)
+    {
+        return GetVCALeaderMask(track) != 0;
     }
     
     bool GetIsVCASpilled(MediaTrack* track)
     {
-        if(vcaLeadTrack_ == nullptr && (DAW::GetTrackGroupMembership(track, "VOLUME_VCA_LEAD") != 0 || DAW::GetTrackGroupMembershipHigh(track, "VOLUME_VCA_LEAD") != 0))
+        if(vcaLeadTrack_ == nullptr && GetIsVCALeader(track))
             return true;
         else if(vcaLeadTrack_ == track)
             return true;
@@ -2476,7 +2814,7 @@ public:
         if(currentTrackVCAFolderMode_ != 1)
             return;
         
-        if(DAW::GetTrackGroupMembership(track, "VOLUME_VCA_LEAD") == 0 && DAW::GetTrackGroupMembershipHigh(track, "VOLUME_VCA_LEAD") == 0)
+        if(! GetIsVCALeader(track))
             return;
 
         if(vcaLeadTrack_ == track)
@@ -2498,37 +2836,101 @@ public:
             vcaLeadTrack_ = track;
        
         vcaTrackOffset_ = 0;
+        isVCASpillDirty_ = true;
     }
 
-    bool GetIsFolderSpilled(MediaTrack* track)
+    void AddFolderChild(int parent, int child)
     {
-        if(find(folderTopParentTracks_.begin(), folderTopParentTracks_.end(), track) != folderTopParentTracks_.end())
-            return true;
-        else if(DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH") == 1)
-            return true;
+        if(folderFirstChildren_[parent] == -1)
+            folderFirstChildren_[parent] = child;
         else
-            return false;
+            folderNextSiblings_[folderLastChildren_[parent]] = child;
+        
+        folderLastChildren_[parent] = child;
     }
-
-    void ToggleFolderSpill(MediaTrack* track)
+    
+    // Built once per track list change, I_FOLDERDEPTH is read once per track
+    void UpdateFolderTree()
     {
-        if(currentTrackVCAFolderMode_ != 2)
+        if(! isFolderTreeDirty_)
             return;
         
-        if(folderTopParentTracks_.size() == 0)
-            return;
-
-        else if(DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH") != 1)
-            return;
+        isFolderTreeDirty_ = false;
         
-        if(folderParentTrack_ == track)
+        int numTracks = trackIdTracks_.size();
+        
+        folderDepths_.assign(numTracks, 0);
+        folderFirstChildren_.assign(numTracks, -1);
+        folderNextSiblings_.assign(numTracks, -1);
+        folderLastChildren_.assign(numTracks, -1);
+        openFolders_.clear();
+        folderTopParentTracks_.clear();
+        
+        for(int i = 0; i < numTracks; i++)
         {
-            if(folderParentTracks_.size() > 0)
+            int depth = DAW::GetMediaTrackInfo_Value(trackIdTracks_[i], "I_FOLDERDEPTH");
+            
+            folderDepths_[i] = depth;
+            
+            if(depth == 1)
             {
-                folderParentTrack_ = folderParentTracks_.back();
-                folderParentTracks_.pop_back();
+                if(openFolders_.size() == 0)
+                    folderTopParentTracks_.push_back(trackIdTracks_[i]);
+                else
+                    AddFolderChild(openFolders_.back(), i);
+                
+                openFolders_.push_back(i);
             }
-            else
+            else if(openFolders_.size() != 0)
+            {
+                AddFolderChild(openFolders_.back(), i);
+                
+                for(int j = 0; j < -depth && openFolders_.size() > 0; j++)
+                    openFolders_.pop_back();
+            }
+        }
+    }
+    
+    bool GetIsFolderParent(MediaTrack* track)
+    {
+        if(GetIsTrackIndexValid())
+        {
+            int id = FindTrackId(track);
+            
+            if(id != 0)
+            {
+                UpdateFolderTree();
+                return folderDepths_[id - 1] == 1;
+            }
+        }
+        
+        return DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH") == 1;
+    }
+    
+    bool GetIsFolderSpilled(MediaTrack* track)
+    {
+        return GetIsFolderParent(track);
+    }
+
+    void ToggleFolderSpill(MediaTrack* track)
+    {
+        if(currentTrackVCAFolderMode_ != 2)
+            return;
+        
+        if(folderTopParentTracks_.size() == 0)
+            return;
+
+        else if(! GetIsFolderParent(track))
+            return;
+        
+        if(folderParentTrack_ == track)
+        {
+            if(folderParentTracks_.size() > 0)
+            {
+                folderParentTrack_ = folderParentTracks_.back();
+                folderParentTracks_.pop_back();
+            }
+            else
                 folderParentTrack_ = nullptr;
         }
         else if(folderParentTrack_ != nullptr)
@@ -2540,6 +2942,7 @@ public:
             folderParentTrack_ = track;
        
         folderTrackOffset_ = 0;
+        isFolderTracksDirty_ = true;
     }
     
     void ToggleSynchPages()
@@ -2549,210 +2952,938 @@ public:
     
     void ToggleScrollLink(int targetChannel)
     {
-        targetScrollLinkChannel_ = targetChannel - 1 < 0 ? 0 : targetChannel - 1;
-        
-        isScrollLinkEnabled_ = ! isScrollLinkEnabled_;
-        
-        OnTrackSelection();
-    }
+        targetScrollLinkChannel_ = targetChannel - 1 < 0 ? 0 : targetChannel - 1;
+        
+        isScrollLinkEnabled_ = ! isScrollLinkEnabled_;
+        
+        OnTrackSelection();
+    }
+    
+    MediaTrack* GetSelectedTrack()
+    {
+        if(GetSelectedTracks().size() != 1)
+            return nullptr;
+        else
+            return selectedTracks_[0];
+    }
+    
+//  Page only uses the following:
+       
+    void OnTrackSelection()
+    {
+        isSelectedTracksDirty_ = true;
+        
+        if(isScrollLinkEnabled_ && tracks_.size() > trackNavigators_.size())
+            ForceScrollLink();
+    }
+    
+    void OnTrackListChange()
+    {
+        isTrackListDirty_ = true;
+        
+        if(isScrollLinkEnabled_ && tracks_.size() > trackNavigators_.size())
+            ForceScrollLink();
+    }
+
+    void OnTrackSelectionBySurface(MediaTrack* track)
+    {
+        isSelectedTracksDirty_ = true;
+        
+        if(isScrollLinkEnabled_)
+        {
+            if(DAW::IsTrackVisible(track, true))
+                DAW::SetMixerScroll(track); // scroll selected MCP tracks into view
+            
+            if(DAW::IsTrackVisible(track, false))
+                DAW::SendCommandMessage(40913); // scroll selected TCP tracks into view
+        }
+    }
+
+    bool GetIsControlTouched(MediaTrack* track, int touchedControl)
+    {
+        if(track == GetMasterTrackNavigator()->GetTrack())
+            return GetIsNavigatorTouched(GetMasterTrackNavigator(), touchedControl);
+        
+        for(auto  [key, navigator] : trackNavigators_)
+            if(track == navigator->GetTrack())
+                return GetIsNavigatorTouched(navigator, touchedControl);
+ 
+        if(MediaTrack* selectedTrack = GetSelectedTrack())
+             if(track == selectedTrack)
+                return GetIsNavigatorTouched(GetSelectedTrackNavigator(), touchedControl);
+        
+        if(MediaTrack* focusedFXTrack = GetFocusedFXNavigator()->GetTrack())
+            if(track == focusedFXTrack)
+                return GetIsNavigatorTouched(GetFocusedFXNavigator(), touchedControl);
+
+        return false;
+    }
+    
+    bool GetIsNavigatorTouched(Navigator* navigator,  int touchedControl)
+    {
+        if(touchedControl == 0)
+            return navigator->GetIsVolumeTouched();
+        else if(touchedControl == 1)
+        {
+            if(navigator->GetIsPanTouched() || navigator->GetIsPanLeftTouched())
+                return true;
+        }
+        else if(touchedControl == 2)
+        {
+            if(navigator->GetIsPanWidthTouched() || navigator->GetIsPanRightTouched())
+                return true;
+        }
+
+        return false;
+    }
+    
+    void RebuildVCASpill()
+    {   
+        if(currentTrackVCAFolderMode_ != 1 || ! isVCASpillDirty_)
+            return;
+    
+        isVCASpillDirty_ = false;
+        
+        vcaTopLeadTracks_.clear();
+        vcaSpillTracks_.clear();
+        
+        uint64_t leadTrackVCALeaderMask = 0;
+        
+        if(vcaLeadTrack_ != nullptr)
+        {
+            leadTrackVCALeaderMask = GetVCALeaderMask(vcaLeadTrack_);
+            vcaSpillTracks_.push_back(vcaLeadTrack_);
+        }
+        
+        UpdateVCAMasks();
+        
+        uint64_t const lowWord = 0xFFFFFFFFULL;
+        uint64_t const highWord = lowWord << 32;
+        
+        // Get Visible Tracks
+        for (int i = 0; i < (int)trackIdTracks_.size(); i++)
+        {
+            MediaTrack* track = trackIdTracks_[i];
+            uint64_t leaderMask = vcaLeaderMasks_[i];
+            uint64_t followerMask = vcaFollowerMasks_[i];
+            
+            if((leaderMask & lowWord) != 0 && (followerMask & lowWord) == 0)
+                vcaTopLeadTracks_.push_back(track);
+            
+            if((leaderMask & highWord) != 0 && (followerMask & highWord) == 0)
+                vcaTopLeadTracks_.push_back(track);
+            
+            if(vcaLeadTrack_ != nullptr && (leadTrackVCALeaderMask & followerMask) != 0)
+                vcaSpillTracks_.push_back(track);
+        }
+    }
+    
+    void RebuildFolderTracks()
+    {
+        if(currentTrackVCAFolderMode_ != 2 || ! isFolderTracksDirty_)
+            return;
+        
+        isFolderTracksDirty_ = false;
+        
+        UpdateFolderTree();
+        
+        folderSpillTracks_.clear();
+        
+        if(folderParentTrack_ != nullptr)
+        {
+            int id = FindTrackId(folderParentTrack_);
+            
+            if(id != 0 && folderDepths_[id - 1] == 1)
+            {
+                int parent = id - 1;
+                
+                folderSpillTracks_.push_back(folderParentTrack_);
+                
+                for(int child = folderFirstChildren_[parent]; child != -1; child = folderNextSiblings_[child])
+                    folderSpillTracks_.push_back(trackIdTracks_[child]);
+            }
+        }
+    }
+    
+    void EnterPage()
+    {
+        /*
+         if(colorTracks_)
+         {
+         // capture track colors
+         for(auto* navigator : trackNavigators_)
+         if(MediaTrack* track = DAW::GetTrackFromGUID(navigator->GetTrackGUID(), followMCP_))
+         trackColors_[navigator->GetTrackGUID()] = DAW::GetTrackColor(track);
+         }
+         */
+    }
+    
+    void LeavePage()
+    {
+        /*
+         if(colorTracks_)
+         {
+         DAW::PreventUIRefresh(1);
+         // reset track colors
+         for(auto* navigator : trackNavigators_)
+         if(MediaTrack* track = DAW::GetTrackFromGUID(navigator->GetTrackGUID(), followMCP_))
+         if(trackColors_.count(navigator->GetTrackGUID()) > 0)
+         DAW::GetSetMediaTrackInfo(track, "I_CUSTOMCOLOR", &trackColors_[navigator->GetTrackGUID()]);
+         DAW::PreventUIRefresh(-1);
+         }
+         */
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TrackMeterManager
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+private:
+    struct TrackMeter
+    {
+        MediaTrack* track = nullptr;
+        int sampledCycle = -1;
+        double lastSampleTime = 0.0;
+        bool isSoloed = false;
+        double peaks[2] = { 0.0, 0.0 };
+        double holdStartTimes[2] = { 0.0, 0.0 };
+    };
+
+    int cycle_ = 0;
+    int anyTrackSoloCycle_ = -1;
+    bool anyTrackSolo_ = false;
+
+    double decayDBPerSecond_ = 0.0;
+    double peakHoldTime_ = 0.0;
+
+    map<MediaTrack*, int> meterIndices_;
+    vector<TrackMeter> meters_;
+
+    void Sample(TrackMeter &meter)
+    {
+        double now = DAW::GetCurrentNumberOfMilliseconds();
+        double decayFactor = 0.0;
+
+        if(decayDBPerSecond_ > 0.0 && meter.sampledCycle >= 0)
+            decayFactor = pow(10.0, -decayDBPerSecond_ * (now - meter.lastSampleTime) / 20000.0);
+
+        for(int i = 0; i < 2; i++)
+        {
+            double peak = DAW::Track_GetPeakInfo(meter.track, i);
+
+            if(peak >= meter.peaks[i] || decayFactor == 0.0)
+            {
+                meter.peaks[i] = peak;
+                meter.holdStartTimes[i] = now;
+            }
+            else if(now - meter.holdStartTimes[i] >= peakHoldTime_)
+            {
+                meter.peaks[i] *= decayFactor;
+
+                if(meter.peaks[i] < peak)
+                    meter.peaks[i] = peak;
+            }
+        }
+
+        meter.isSoloed = DAW::GetMediaTrackInfo_Value(meter.track, "I_SOLO") != 0;
+        meter.lastSampleTime = now;
+        meter.sampledCycle = cycle_;
+    }
+
+    TrackMeter &GetMeter(MediaTrack* track)
+    {
+        int index = 0;
+
+        auto it = meterIndices_.find(track);
+
+        if(it != meterIndices_.end())
+            index = it->second;
+        else
+        {
+            index = meters_.size();
+            meterIndices_[track] = index;
+            meters_.push_back(TrackMeter());
+            meters_.back().track = track;
+        }
+
+        TrackMeter &meter = meters_[index];
+
+        if(meter.sampledCycle != cycle_)
+            Sample(meter);
+
+        return meter;
+    }
+
+public:
+    // decayDBPerSecond == 0 turns ballistics off, meters then show the raw peak from each cycle
+    void SetBallistics(double decayDBPerSecond, double peakHoldTime)
+    {
+        decayDBPerSecond_ = decayDBPerSecond < 0.0 ? 0.0 : decayDBPerSecond;
+        peakHoldTime_ = peakHoldTime < 0.0 ? 0.0 : peakHoldTime * 1000.0; // peakHoldTime is specified in seconds, peakHoldTime_ is in milliseconds
+    }
+
+    void BeginCycle()
+    {
+        cycle_++;
+    }
+
+    void OnTrackListChange()
+    {
+        meterIndices_.clear();
+        meters_.clear();
+    }
+
+    double GetPeak(MediaTrack* track, int channel)
+    {
+        if(channel < 0 || channel > 1)
+            return DAW::Track_GetPeakInfo(track, channel);
+        else
+            return GetMeter(track).peaks[channel];
+    }
+
+    bool GetIsSilencedBySolo(MediaTrack* track)
+    {
+        if(anyTrackSoloCycle_ != cycle_)
+        {
+            anyTrackSolo_ = DAW::AnyTrackSolo(nullptr);
+            anyTrackSoloCycle_ = cycle_;
+        }
+
+        return anyTrackSolo_ && ! GetMeter(track).isSoloed;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TrackState
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+private:
+    enum Fields
+    {
+        VolumePan       = 1 << 0,
+        PanMode         = 1 << 1,
+        Width           = 1 << 2,
+        DualPanL        = 1 << 3,
+        DualPanR        = 1 << 4,
+        Mute            = 1 << 5,
+        Solo            = 1 << 6,
+        RecArm          = 1 << 7,
+        Selected        = 1 << 8,
+        Name            = 1 << 9,
+        Color           = 1 << 10,
+        AutoMode        = 1 << 11,
+        InputMonitor    = 1 << 12
+    };
+    
+    MediaTrack* track_ = nullptr;
+    int cycle_ = -1;
+    unsigned int sampledFields_ = 0;
+    int generation_ = 0;
+    
+    double volume_ = 0.0;
+    double pan_ = 0.0;
+    int panMode_ = 0;
+    double width_ = 0.0;
+    double dualPanL_ = 0.0;
+    double dualPanR_ = 0.0;
+    bool isMuted_ = false;
+    bool isSoloed_ = false;
+    bool isRecArmed_ = false;
+    bool isSelected_ = false;
+    string name_ = "";
+    rgba_color color_;
+    int autoMode_ = 0;
+    int recMonitorMode_ = 0;
+    int recMonitorItemMode_ = 0;
+    
+    bool NeedsSample(Fields field)
+    {
+        if(sampledFields_ & field)
+            return false;
+        
+        sampledFields_ |= field;
+        
+        return true;
+    }
+    
+public:
+    TrackState(MediaTrack* track, int generation) : track_(track), generation_(generation) {}
+    
+    int GetGeneration() { return generation_; }
+    void SetGeneration(int generation) { generation_ = generation; }
+    
+    void BeginCycle(int cycle)
+    {
+        if(cycle_ != cycle)
+        {
+            cycle_ = cycle;
+            sampledFields_ = 0;
+        }
+    }
+    
+    double GetVolume()
+    {
+        if(NeedsSample(VolumePan))
+            DAW::GetTrackUIVolPan(track_, &volume_, &pan_);
+        
+        return volume_;
+    }
+    
+    double GetPan()
+    {
+        if(NeedsSample(VolumePan))
+            DAW::GetTrackUIVolPan(track_, &volume_, &pan_);
+        
+        return pan_;
+    }
+    
+    int GetPanMode()
+    {
+        if(NeedsSample(PanMode))
+        {
+            double pan1, pan2 = 0.0;
+            DAW::GetTrackUIPan(track_, &pan1, &pan2, &panMode_);
+        }
+        
+        return panMode_;
+    }
+    
+    double GetWidth()
+    {
+        if(NeedsSample(Width))
+            width_ = DAW::GetMediaTrackInfo_Value(track_, "D_WIDTH");
+        
+        return width_;
+    }
+    
+    double GetDualPanL()
+    {
+        if(NeedsSample(DualPanL))
+            dualPanL_ = DAW::GetMediaTrackInfo_Value(track_, "D_DUALPANL");
+        
+        return dualPanL_;
+    }
+    
+    double GetDualPanR()
+    {
+        if(NeedsSample(DualPanR))
+            dualPanR_ = DAW::GetMediaTrackInfo_Value(track_, "D_DUALPANR");
+        
+        return dualPanR_;
+    }
+    
+    bool GetIsMuted()
+    {
+        if(NeedsSample(Mute))
+            DAW::GetTrackUIMute(track_, &isMuted_);
+        
+        return isMuted_;
+    }
+    
+    bool GetIsSoloed()
+    {
+        if(NeedsSample(Solo))
+            isSoloed_ = DAW::GetMediaTrackInfo_Value(track_, "I_SOLO") > 0;
+        
+        return isSoloed_;
+    }
+    
+    bool GetIsRecArmed()
+    {
+        if(NeedsSample(RecArm))
+            isRecArmed_ = DAW::GetMediaTrackInfo_Value(track_, "I_RECARM") != 0;
+        
+        return isRecArmed_;
+    }
+    
+    bool GetIsSelected()
+    {
+        if(NeedsSample(Selected))
+            isSelected_ = DAW::GetMediaTrackInfo_Value(track_, "I_SELECTED") != 0;
+        
+        return isSelected_;
+    }
+    
+    const string &GetName()
+    {
+        if(NeedsSample(Name))
+        {
+            char buf[BUFSZ];
+            DAW::GetTrackName(track_, buf, sizeof(buf));
+            name_ = buf;
+        }
+        
+        return name_;
+    }
+    
+    rgba_color GetColor()
+    {
+        if(NeedsSample(Color))
+            color_ = DAW::GetTrackColor(track_);
+        
+        return color_;
+    }
+    
+    int GetAutoMode()
+    {
+        if(NeedsSample(AutoMode))
+            autoMode_ = DAW::GetMediaTrackInfo_Value(track_, "I_AUTOMODE");
+        
+        return autoMode_;
+    }
+    
+    // I_RECMON : int * : record monitor (0=off, 1=normal, 2=not when playing (tapestyle))
+    int GetRecMonitorMode()
+    {
+        if(NeedsSample(InputMonitor))
+        {
+            recMonitorMode_ = DAW::GetMediaTrackInfo_Value(track_, "I_RECMON");
+            recMonitorItemMode_ = DAW::GetMediaTrackInfo_Value(track_, "I_RECMONITEMS");
+        }
+        
+        return recMonitorMode_;
+    }
+    
+    // I_RECMONITEMS : int * : monitor items while recording (0=off, 1=on)
+    int GetRecMonitorItemMode()
+    {
+        if(NeedsSample(InputMonitor))
+        {
+            recMonitorMode_ = DAW::GetMediaTrackInfo_Value(track_, "I_RECMON");
+            recMonitorItemMode_ = DAW::GetMediaTrackInfo_Value(track_, "I_RECMONITEMS");
+        }
+        
+        return recMonitorItemMode_;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TrackStateManager
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+private:
+    int cycle_ = 0;
+    int generation_ = 0;
+    double lastResyncTime_ = 0.0;
+    double const resyncInterval_ = 1000.0; // ms, catches changes Reaper doesn't report through the surface callbacks
+    
+    map<MediaTrack*, TrackState> trackStates_;
+    
+    TrackState &FindTrackState(MediaTrack* track)
+    {
+        auto it = trackStates_.find(track);
+        
+        if(it == trackStates_.end())
+            it = trackStates_.emplace(track, TrackState(track, ++generation_)).first;
+
+        return it->second;
+    }
+    
+public:
+    // Feedback reads go through here, Do and Touch read Reaper directly so they never act on a stale value
+    void BeginCycle()
+    {
+        cycle_++;
+        
+        double now = DAW::GetCurrentNumberOfMilliseconds();
+        
+        if(now - lastResyncTime_ > resyncInterval_)
+        {
+            lastResyncTime_ = now;
+            
+            for(auto &[track, state] : trackStates_)
+                state.SetGeneration(++generation_);
+        }
+    }
+    
+    void OnTrackListChange()
+    {
+        trackStates_.clear();
+    }
+    
+    // Reaper reports changes on every track, a track no surface has read yet has nothing cached to go stale
+    void SetTrackIsDirty(MediaTrack* track)
+    {
+        auto it = trackStates_.find(track);
+        
+        if(it != trackStates_.end())
+            it->second.SetGeneration(++generation_);
+    }
+    
+    TrackState &GetTrackState(MediaTrack* track)
+    {
+        TrackState &state = FindTrackState(track);
+        
+        state.BeginCycle(cycle_);
+        
+        return state;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TrackRoutingManager
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+private:
+    struct RoutingEndpoint
+    {
+        bool isValid = false;
+        MediaTrack* track = nullptr;
+        string name = "";
+    };
+    
+    struct TrackRouting
+    {
+        bool isValid = false;
+        int numHardwareSends = 0;
+        int numSends = 0;
+        int numReceives = 0;
+        map<int, RoutingEndpoint> sends;
+        map<int, RoutingEndpoint> receives;
+    };
+    
+    int projectStateChangeCount_ = -1;
+    
+    map<MediaTrack*, TrackRouting> trackRoutings_;
+    
+    TrackRouting &GetTrackRouting(MediaTrack* track)
+    {
+        auto it = trackRoutings_.find(track);
+        
+        if(it == trackRoutings_.end())
+            it = trackRoutings_.emplace(track, TrackRouting()).first;
+        
+        TrackRouting &routing = it->second;
+        
+        if(! routing.isValid)
+        {
+            routing.isValid = true;
+            routing.numHardwareSends = DAW::GetTrackNumSends(track, 1);
+            routing.numSends = DAW::GetTrackNumSends(track, 0);
+            routing.numReceives = DAW::GetTrackNumSends(track, -1);
+            
+            for(auto &[index, endpoint] : routing.sends)
+                endpoint.isValid = false;
+            
+            for(auto &[index, endpoint] : routing.receives)
+                endpoint.isValid = false;
+        }
+        
+        return routing;
+    }
+    
+    // Assigning into the existing name reuses its buffer, so a refresh after a project change doesn't allocate
+    void SetEndpoint(RoutingEndpoint &endpoint, MediaTrack* endpointTrack)
+    {
+        endpoint.isValid = true;
+        endpoint.track = endpointTrack;
+        endpoint.name.clear();
+        
+        if(endpointTrack != nullptr)
+            if(char* name = (char *)DAW::GetSetMediaTrackInfo(endpointTrack, "P_NAME", NULL))
+                endpoint.name = name;
+    }
+    
+    RoutingEndpoint &GetSend(MediaTrack* track, int sendIndex)
+    {
+        TrackRouting &routing = GetTrackRouting(track);
+        
+        auto it = routing.sends.find(sendIndex);
+        
+        if(it == routing.sends.end())
+            it = routing.sends.emplace(sendIndex, RoutingEndpoint()).first;
+        
+        if(! it->second.isValid)
+            SetEndpoint(it->second, sendIndex < routing.numSends ? (MediaTrack *)DAW::GetSetTrackSendInfo(track, 0, sendIndex + routing.numHardwareSends, "P_DESTTRACK", 0) : nullptr);
+        
+        return it->second;
+    }
+    
+    RoutingEndpoint &GetReceive(MediaTrack* track, int receiveIndex)
+    {
+        TrackRouting &routing = GetTrackRouting(track);
+        
+        auto it = routing.receives.find(receiveIndex);
+        
+        if(it == routing.receives.end())
+            it = routing.receives.emplace(receiveIndex, RoutingEndpoint()).first;
+        
+        if(! it->second.isValid)
+            SetEndpoint(it->second, receiveIndex < routing.numReceives ? (MediaTrack *)DAW::GetSetTrackSendInfo(track, -1, receiveIndex, "P_SRCTRACK", 0) : nullptr);
+        
+        return it->second;
+    }
+    
+public:
+    // Routing and track name edits all bump the project state change count, so one read per cycle keeps the cache honest
+    // The entries are only marked stale, the tracks are still the same ones, so the nodes are kept rather than freed and rebuilt
+    void BeginCycle()
+    {
+        int projectStateChangeCount = DAW::GetProjectStateChangeCount();
+        
+        if(projectStateChangeCount != projectStateChangeCount_)
+        {
+            projectStateChangeCount_ = projectStateChangeCount;
+            
+            for(auto &[track, routing] : trackRoutings_)
+                routing.isValid = false;
+        }
+    }
+    
+    void OnTrackListChange()
+    {
+        trackRoutings_.clear();
+    }
+    
+    int GetNumHardwareSends(MediaTrack* track) { return GetTrackRouting(track).numHardwareSends; }
+    int GetNumSends(MediaTrack* track) { return GetTrackRouting(track).numSends; }
+    int GetNumReceives(MediaTrack* track) { return GetTrackRouting(track).numReceives; }
+    MediaTrack* GetSendDestination(MediaTrack* track, int sendIndex) { return GetSend(track, sendIndex).track; }
+    const string &GetSendDestinationName(MediaTrack* track, int sendIndex) { return GetSend(track, sendIndex).name; }
+    MediaTrack* GetReceiveSource(MediaTrack* track, int receiveIndex) { return GetReceive(track, receiveIndex).track; }
+    const string &GetReceiveSourceName(MediaTrack* track, int receiveIndex) { return GetReceive(track, receiveIndex).name; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class FocusedFXManager
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+private:
+    int generation_ = 0;
+    
+    int focusedFXRetval_ = 0;
+    int focusedFXTrackNumber_ = 0;
+    int focusedFXItemNumber_ = 0;
+    int focusedFXIndex_ = 0;
+    
+    bool hasLastTouchedFX_ = false;
+    int lastTouchedFXTrackNumber_ = 0;
+    int lastTouchedFXSlot_ = 0;
+    int lastTouchedFXParam_ = 0;
+    
+public:
+    // Polled once per cycle for the whole Page, surfaces compare generations to see if focus moved
+    void Poll()
+    {
+        int trackNumber = 0;
+        int itemNumber = 0;
+        int fxIndex = 0;
+        
+        int retval = DAW::GetFocusedFX2(&trackNumber, &itemNumber, &fxIndex);
+        
+        if(retval != focusedFXRetval_ || trackNumber != focusedFXTrackNumber_ || itemNumber != focusedFXItemNumber_ || fxIndex != focusedFXIndex_)
+        {
+            focusedFXRetval_ = retval;
+            focusedFXTrackNumber_ = trackNumber;
+            focusedFXItemNumber_ = itemNumber;
+            focusedFXIndex_ = fxIndex;
+            generation_++;
+        }
+        
+        hasLastTouchedFX_ = DAW::GetLastTouchedFX(&lastTouchedFXTrackNumber_, &lastTouchedFXSlot_, &lastTouchedFXParam_);
+    }
+    
+    int GetGeneration() { return generation_; }
+    
+    int GetFocusedFX(int &trackNumber, int &itemNumber, int &fxIndex)
+    {
+        trackNumber = focusedFXTrackNumber_;
+        itemNumber = focusedFXItemNumber_;
+        fxIndex = focusedFXIndex_;
+        
+        return focusedFXRetval_;
+    }
+    
+    bool GetLastTouchedFX(int &trackNumber, int &fxSlot, int &fxParam)
+    {
+        trackNumber = lastTouchedFXTrackNumber_;
+        fxSlot = lastTouchedFXSlot_;
+        fxParam = lastTouchedFXParam_;
+        
+        return hasLastTouchedFX_;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class FXParamManager
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+private:
+    struct FXParam
+    {
+        bool hasName = false;
+        string name = "";
+        bool hasValue = false;
+        double value = 0.0;
+        string formattedValue = "";
+    };
     
-    MediaTrack* GetSelectedTrack()
+    // Keyed by fxSlot and paramIndex, the slot can carry the record input flag (0x1000000) or an item FX encoding, so the two are not packed together
+    map<MediaTrack*, map<pair<int, int>, FXParam>> fxParams_;
+    
+    FXParam &GetFXParam(MediaTrack* track, int fxSlot, int paramIndex)
     {
-        if(DAW::CountSelectedTracks() != 1)
-            return nullptr;
-        else
-            return DAW::GetSelectedTrack(0);
+        return fxParams_[track][make_pair(fxSlot, paramIndex)];
     }
     
-//  Page only uses the following:
-       
-    void OnTrackSelection()
+public:
+    // Slot indices only move when the FX chain changes, and Reaper reports that through CSURF_EXT_SETFXCHANGE
+    void OnTrackFXListChange(MediaTrack* track)
     {
-        if(isScrollLinkEnabled_ && tracks_.size() > trackNavigators_.size())
-            ForceScrollLink();
+        fxParams_.erase(track);
     }
     
     void OnTrackListChange()
     {
-        if(isScrollLinkEnabled_ && tracks_.size() > trackNavigators_.size())
-            ForceScrollLink();
+        fxParams_.clear();
     }
-
-    void OnTrackSelectionBySurface(MediaTrack* track)
+    
+    const string &GetParamName(MediaTrack* track, int fxSlot, int paramIndex)
     {
-        if(isScrollLinkEnabled_)
+        FXParam &fxParam = GetFXParam(track, fxSlot, paramIndex);
+        
+        if(! fxParam.hasName)
         {
-            if(DAW::IsTrackVisible(track, true))
-                DAW::SetMixerScroll(track); // scroll selected MCP tracks into view
-            
-            if(DAW::IsTrackVisible(track, false))
-                DAW::SendCommandMessage(40913); // scroll selected TCP tracks into view
+            char fxParamName[BUFSZ];
+            fxParamName[0] = 0;
+            DAW::TrackFX_GetParamName(track, fxSlot, paramIndex, fxParamName, sizeof(fxParamName));
+            fxParam.name = fxParamName;
+            fxParam.hasName = true;
         }
-    }
-
-    bool GetIsControlTouched(MediaTrack* track, int touchedControl)
-    {
-        if(track == GetMasterTrackNavigator()->GetTrack())
-            return GetIsNavigatorTouched(GetMasterTrackNavigator(), touchedControl);
-        
-        for(auto  [key, navigator] : trackNavigators_)
-            if(track == navigator->GetTrack())
-                return GetIsNavigatorTouched(navigator, touchedControl);
- 
-        if(MediaTrack* selectedTrack = GetSelectedTrack())
-             if(track == selectedTrack)
-                return GetIsNavigatorTouched(GetSelectedTrackNavigator(), touchedControl);
         
-        if(MediaTrack* focusedFXTrack = GetFocusedFXNavigator()->GetTrack())
-            if(track == focusedFXTrack)
-                return GetIsNavigatorTouched(GetFocusedFXNavigator(), touchedControl);
-
-        return false;
+        return fxParam.name;
     }
     
-    bool GetIsNavigatorTouched(Navigator* navigator,  int touchedControl)
+    const string &GetFormattedParamValue(MediaTrack* track, int fxSlot, int paramIndex)
     {
-        if(touchedControl == 0)
-            return navigator->GetIsVolumeTouched();
-        else if(touchedControl == 1)
-        {
-            if(navigator->GetIsPanTouched() || navigator->GetIsPanLeftTouched())
-                return true;
-        }
-        else if(touchedControl == 2)
+        FXParam &fxParam = GetFXParam(track, fxSlot, paramIndex);
+        
+        double min, max = 0.0;
+        double value = DAW::TrackFX_GetParam(track, fxSlot, paramIndex, &min, &max);
+        
+        if(! fxParam.hasValue || value != fxParam.value)
         {
-            if(navigator->GetIsPanWidthTouched() || navigator->GetIsPanRightTouched())
-                return true;
+            char fxParamValue[128];
+            fxParamValue[0] = 0;
+            DAW::TrackFX_GetFormattedParamValue(track, fxSlot, paramIndex, fxParamValue, sizeof(fxParamValue));
+            fxParam.formattedValue = fxParamValue;
+            fxParam.value = value;
+            fxParam.hasValue = true;
         }
-
-        return false;
+        
+        return fxParam.formattedValue;
     }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class FeedbackScheduler
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+{
+private:
+    struct Staleness
+    {
+        int numDeferred = 0; // last cycle
+        int maxAge = 0; // last cycle, in cycles, of the longest held back update that went out
+        int totalDeferred = 0; // distinct updates held back, one held for several cycles counts once
+        int worstAge = 0;
+    };
     
-    void RebuildVCASpill()
-    {   
-        if(currentTrackVCAFolderMode_ != 1)
-            return;
+    double budget_ = 0.0; // ms per cycle, 0 means every update goes out every cycle
+    double cycleStartTime_ = 0.0;
+    int cycle_ = 0;
+    double lastLogTime_ = 0.0;
     
-        vcaTopLeadTracks_.clear();
-        vcaSpillTracks_.clear();
-        
-        bitset<32> leadTrackVCALeaderGroup;
-        bitset<32> leadTrackVCALeaderGroupHigh;
+    // ms between refreshes, 0 refreshes every cycle
+    double refreshIntervals_[NumFeedbackClasses] = { 0.0, 1000.0 / 15.0, 1000.0 / 25.0, 1000.0 / 10.0 };
+    double lastRefreshTimes_[NumFeedbackClasses] = {};
+    bool isRefreshDue_[NumFeedbackClasses] = {};
+    
+    Staleness staleness_[NumFeedbackClasses];
+    
+public:
+    void SetBudget(double budget) { budget_ = budget; }
+    
+    void SetRefreshRate(int feedbackClass, double rate)
+    {
+        if(feedbackClass != FeedbackClassUnspecified)
+            refreshIntervals_[feedbackClass] = rate > 0.0 ? 1000.0 / rate : 0.0;
+    }
+    
+    void BeginCycle()
+    {
+        cycle_++;
+        cycleStartTime_ = DAW::GetCurrentNumberOfMilliseconds();
         
-        if(vcaLeadTrack_ != nullptr)
+        for(auto &staleness : staleness_)
         {
-            leadTrackVCALeaderGroup = DAW::GetTrackGroupMembership(vcaLeadTrack_, "VOLUME_VCA_LEAD");
-            leadTrackVCALeaderGroupHigh = DAW::GetTrackGroupMembershipHigh(vcaLeadTrack_, "VOLUME_VCA_LEAD");
-            vcaSpillTracks_.push_back(vcaLeadTrack_);
+            staleness.numDeferred = 0;
+            staleness.maxAge = 0;
         }
         
-        // Get Visible Tracks
-        for (int i = 1; i <= GetNumTracks(); i++)
+        // The phase advances by the interval, so rates that do not divide the cycle rate still average out right
+        for(int i = 0; i < NumFeedbackClasses; i++)
         {
-            MediaTrack* track = DAW::CSurf_TrackFromID(i, followMCP_);
-            
-            if(DAW::GetTrackGroupMembership(track, "VOLUME_VCA_LEAD") != 0 && DAW::GetTrackGroupMembership(track, "VOLUME_VCA_FOLLOW") == 0)
-                vcaTopLeadTracks_.push_back(track);
-            
-            if(DAW::GetTrackGroupMembershipHigh(track, "VOLUME_VCA_LEAD") != 0 && DAW::GetTrackGroupMembershipHigh(track, "VOLUME_VCA_FOLLOW") == 0)
-                vcaTopLeadTracks_.push_back(track);
+            isRefreshDue_[i] = cycleStartTime_ - lastRefreshTimes_[i] >= refreshIntervals_[i];
             
-            if(vcaLeadTrack_ != nullptr)
+            if(isRefreshDue_[i])
             {
-                bool isFollower = false;
-                
-                bitset<32> leadTrackVCAFollowerGroup(DAW::GetTrackGroupMembership(track, "VOLUME_VCA_FOLLOW"));
-                bitset<32> leadTrackVCAFollowerGroupHigh(DAW::GetTrackGroupMembershipHigh(track, "VOLUME_VCA_FOLLOW"));
-
-                for(int i = 0; i < 32; i++)
-                {
-                    if((leadTrackVCALeaderGroup[i] == 1 && leadTrackVCAFollowerGroup[i] == 1)
-                       || (leadTrackVCALeaderGroupHigh[i] == 1 && leadTrackVCAFollowerGroupHigh[i] == 1))
-                    {
-                        isFollower = true;
-                        break;
-                    }
-                }
+                lastRefreshTimes_[i] += refreshIntervals_[i];
                 
-                if(isFollower)
-                    vcaSpillTracks_.push_back(track);
+                // more than an interval behind, after a stall or at startup, so start again from now rather than catch up in a burst
+                if(cycleStartTime_ - lastRefreshTimes_[i] >= refreshIntervals_[i])
+                    lastRefreshTimes_[i] = cycleStartTime_;
             }
         }
     }
     
-    void RebuildFolderTracks()
+    int GetCycle() { return cycle_; }
+    bool GetIsRefreshDue(int feedbackClass) { return isRefreshDue_[feedbackClass]; }
+    double GetRefreshInterval(int feedbackClass) { return refreshIntervals_[feedbackClass]; }
+    
+    bool GetIsOverBudget()
     {
-        if(currentTrackVCAFolderMode_ != 2)
-            return;
-        
-        folderTopParentTracks_.clear();
-        folderDictionary_.clear();
-        folderSpillTracks_.clear();
-       
-        vector<vector<MediaTrack*>*> currentDepthTracks;
-        
-        for (int i = 1; i <= GetNumTracks(); i++)
-        {
-            MediaTrack* track = DAW::CSurf_TrackFromID(i, followMCP_);
-
-            if(DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH") == 1)
-            {
-                if(currentDepthTracks.size() == 0)
-                    folderTopParentTracks_.push_back(track);
-                else
-                    currentDepthTracks.back()->push_back(track);
-                
-                folderDictionary_[track].push_back(track);
-                
-                currentDepthTracks.push_back(&folderDictionary_[track]);
-            }
-            else if(DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH") == 0 && currentDepthTracks.size() != 0)
-            {
-                currentDepthTracks.back()->push_back(track);
-            }
-            else if(DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH") < 0)
-            {
-                currentDepthTracks.back()->push_back(track);
-                
-                int folderBackTrack = -DAW::GetMediaTrackInfo_Value(track, "I_FOLDERDEPTH");
-                
-                for(int i = 0; i < folderBackTrack && currentDepthTracks.size() > 0; i++)
-                    currentDepthTracks.pop_back();
-            }
-        }
-        
-        if(folderParentTrack_ != nullptr)
-            for(auto track : folderDictionary_[folderParentTrack_])
-                folderSpillTracks_.push_back(track);
+        return budget_ > 0.0 && DAW::GetCurrentNumberOfMilliseconds() - cycleStartTime_ > budget_;
     }
     
-    void EnterPage()
+    void RecordDeferred(int feedbackClass, int count, int newCount)
     {
-        /*
-         if(colorTracks_)
-         {
-         // capture track colors
-         for(auto* navigator : trackNavigators_)
-         if(MediaTrack* track = DAW::GetTrackFromGUID(navigator->GetTrackGUID(), followMCP_))
-         trackColors_[navigator->GetTrackGUID()] = DAW::GetTrackColor(track);
-         }
-         */
+        staleness_[feedbackClass].numDeferred += count;
+        staleness_[feedbackClass].totalDeferred += newCount;
     }
     
-    void LeavePage()
+    void RecordAge(int feedbackClass, int age)
     {
-        /*
-         if(colorTracks_)
-         {
-         DAW::PreventUIRefresh(1);
-         // reset track colors
-         for(auto* navigator : trackNavigators_)
-         if(MediaTrack* track = DAW::GetTrackFromGUID(navigator->GetTrackGUID(), followMCP_))
-         if(trackColors_.count(navigator->GetTrackGUID()) > 0)
-         DAW::GetSetMediaTrackInfo(track, "I_CUSTOMCOLOR", &trackColors_[navigator->GetTrackGUID()]);
-         DAW::PreventUIRefresh(-1);
-         }
-         */
+        if(age > staleness_[feedbackClass].maxAge)
+            staleness_[feedbackClass].maxAge = age;
+        
+        if(age > staleness_[feedbackClass].worstAge)
+            staleness_[feedbackClass].worstAge = age;
+    }
+    
+    int GetNumDeferred(int feedbackClass) { return staleness_[feedbackClass].numDeferred; }
+    int GetMaxAge(int feedbackClass) { return staleness_[feedbackClass].maxAge; }
+    int GetTotalDeferred(int feedbackClass) { return staleness_[feedbackClass].totalDeferred; }
+    int GetWorstAge(int feedbackClass) { return staleness_[feedbackClass].worstAge; }
+    
+    void LogStaleness(string pageName)
+    {
+        double now = DAW::GetCurrentNumberOfMilliseconds();
+        
+        if(now - lastLogTime_ < 1000.0)
+            return;
+        
+        lastLogTime_ = now;
+        
+        const char* classNames[NumFeedbackClasses] = { "High", "Display", "Meter", "Time" };
+        
+        char buffer[250];
+        
+        for(int i = 0; i < NumFeedbackClasses; i++)
+        {
+            snprintf(buffer, sizeof(buffer), "%s %s - deferred %d, max age %d, total deferred %d, worst age %d\n", pageName.c_str(), classNames[i], staleness_[i].numDeferred, staleness_[i].maxAge, staleness_[i].totalDeferred, staleness_[i].worstAge);
+            DAW::ShowConsoleMsg(buffer);
+        }
     }
 };
 
@@ -2763,11 +3894,27 @@ class Page
 private:
     string const name_ = "";
     TrackNavigationManager* const trackNavigationManager_ = nullptr;
+    TrackMeterManager* const trackMeterManager_ = nullptr;
+    TrackStateManager* const trackStateManager_ = nullptr;
+    FXParamManager* const fxParamManager_ = nullptr;
+    FocusedFXManager* const focusedFXManager_ = nullptr;
+    TrackRoutingManager* const trackRoutingManager_ = nullptr;
+    FeedbackScheduler* const feedbackScheduler_ = nullptr;
     ModifierManager* modifierManager_ = nullptr;
     vector<ControlSurface*> surfaces_;
+    bool hasInput_ = false; // any surface received input in the latest cycle
+    
+    void UpdateHasInput()
+    {
+        hasInput_ = false;
+        
+        for(auto surface : surfaces_)
+            if(surface->GetZoneManager()->GetHasInput())
+                hasInput_ = true;
+    }
     
 public:
-    Page(string name, bool followMCP,  bool synchPages, bool isScrollLinkEnabled) : name_(name), trackNavigationManager_(new TrackNavigationManager(this, followMCP, synchPages, isScrollLinkEnabled)), modifierManager_(new ModifierManager(this)) {}
+    Page(string name, bool followMCP,  bool synchPages, bool isScrollLinkEnabled) : name_(name), trackNavigationManager_(new TrackNavigationManager(this, followMCP, synchPages, isScrollLinkEnabled)), trackMeterManager_(new TrackMeterManager()), trackStateManager_(new TrackStateManager()), fxParamManager_(new FXParamManager()), focusedFXManager_(new FocusedFXManager()), trackRoutingManager_(new TrackRoutingManager()), feedbackScheduler_(new FeedbackScheduler()), modifierManager_(new ModifierManager(this)) {}
     
     ~Page()
     {
@@ -2776,16 +3923,28 @@ public:
             delete surface;
             surface = nullptr;
         }
+        
+        delete trackMeterManager_;
+        delete trackStateManager_;
+        delete fxParamManager_;
+        delete focusedFXManager_;
+        delete trackRoutingManager_;
+        delete feedbackScheduler_;
     }
     
-    string GetName() { return name_; }
+    const string &GetName() { return name_; }
 
     ModifierManager* GetModifierManager() { return modifierManager_; }
     
-    void UpdateCurrentActionContextModifiers()
+    bool GetHasInput() { return hasInput_; }
+    
+    bool GetIsTransportWinding()
     {
-         for(auto surface : surfaces_)
-            surface->UpdateCurrentActionContextModifiers();
+        for(auto surface : surfaces_)
+            if(surface->GetIsRewinding() || surface->GetIsFastForwarding())
+                return true;
+        
+        return false;
     }
     
     void ForceClear()
@@ -2833,6 +3992,26 @@ public:
     void OnTrackListChange()
     {
         trackNavigationManager_->OnTrackListChange();
+        ClearTrackCaches();
+    }
+    
+    // Everything keyed by MediaTrack*, inactive Pages clear it too so they never hold a deleted track
+    void ClearTrackCaches()
+    {
+        trackMeterManager_->OnTrackListChange();
+        trackStateManager_->OnTrackListChange();
+        fxParamManager_->OnTrackListChange();
+        trackRoutingManager_->OnTrackListChange();
+        
+        // The FX on the tracks may have changed too, so drop the pooled FX Zones rather than keep them forever
+        for(auto surface : surfaces_)
+            surface->GetZoneManager()->ClearFXZonePool();
+    }
+    
+    void OnTrackSelectionChange(MediaTrack* track)
+    {
+        trackNavigationManager_->OnTrackSelectionChange();
+        trackStateManager_->SetTrackIsDirty(track);
     }
     
     void OnTrackSelectionBySurface(MediaTrack* track)
@@ -2845,6 +4024,8 @@ public:
 
     void TrackFXListChanged(MediaTrack* track)
     {
+        fxParamManager_->OnTrackFXListChange(track);
+        
         for(auto surface : surfaces_)
             surface->TrackFXListChanged(track);
     }
@@ -2988,17 +4169,71 @@ public:
     int GetIdFromTrack(MediaTrack* track) { return trackNavigationManager_->GetIdFromTrack(track); }
     bool GetIsTrackVisible(MediaTrack* track) { return trackNavigationManager_->GetIsTrackVisible(track); }
     bool GetIsVCASpilled(MediaTrack* track) { return trackNavigationManager_->GetIsVCASpilled(track); }
+    bool GetIsVCALeader(MediaTrack* track) { return trackNavigationManager_->GetIsVCALeader(track); }
     void ToggleVCASpill(MediaTrack* track) { trackNavigationManager_->ToggleVCASpill(track); }
     bool GetIsFolderSpilled(MediaTrack* track) { return trackNavigationManager_->GetIsFolderSpilled(track); }
+    bool GetIsFolderParent(MediaTrack* track) { return trackNavigationManager_->GetIsFolderParent(track); }
     void ToggleFolderSpill(MediaTrack* track) { trackNavigationManager_->ToggleFolderSpill(track); }
     void ToggleScrollLink(int targetChannel) { trackNavigationManager_->ToggleScrollLink(targetChannel); }
     void ToggleSynchPages() { trackNavigationManager_->ToggleSynchPages(); }
     MediaTrack* GetSelectedTrack() { return trackNavigationManager_->GetSelectedTrack(); }
     void NextInputMonitorMode(MediaTrack* track) { trackNavigationManager_->NextInputMonitorMode(track); }
-    string GetAutoModeDisplayName(int modeIndex) { return trackNavigationManager_->GetAutoModeDisplayName(modeIndex); }
-    string GetGlobalAutoModeDisplayName() { return trackNavigationManager_->GetGlobalAutoModeDisplayName(); }
-    string GetCurrentInputMonitorMode(MediaTrack* track) { return trackNavigationManager_->GetCurrentInputMonitorMode(track); }
+    const char* GetAutoModeDisplayName(int modeIndex) { return trackNavigationManager_->GetAutoModeDisplayName(modeIndex); }
+    const char* GetGlobalAutoModeDisplayName() { return trackNavigationManager_->GetGlobalAutoModeDisplayName(); }
+    const char* GetCurrentInputMonitorMode(MediaTrack* track) { return trackNavigationManager_->GetInputMonitorModeDisplayName(GetTrackState(track).GetRecMonitorMode(), GetTrackState(track).GetRecMonitorItemMode()); }
     vector<MediaTrack*> &GetSelectedTracks() { return trackNavigationManager_->GetSelectedTracks(); }
+    bool GetIsTrackSelected(MediaTrack* track) { return trackNavigationManager_->GetIsTrackSelected(track); }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Page facade for TrackMeterManager
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void SetMeterBallistics(double decayDBPerSecond, double peakHoldTime) { trackMeterManager_->SetBallistics(decayDBPerSecond, peakHoldTime); }
+    double GetTrackPeak(MediaTrack* track, int channel) { return trackMeterManager_->GetPeak(track, channel); }
+    bool GetIsTrackMeterSilencedBySolo(MediaTrack* track) { return trackMeterManager_->GetIsSilencedBySolo(track); }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Page facade for TrackStateManager
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TrackState &GetTrackState(MediaTrack* track) { return trackStateManager_->GetTrackState(track); }
+    void SetTrackIsDirty(MediaTrack* track) { trackStateManager_->SetTrackIsDirty(track); }
+    rgba_color GetTrackColor(MediaTrack* track) { return trackStateManager_->GetTrackState(track).GetColor(); }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Page facade for FXParamManager
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const string &GetFXParamName(MediaTrack* track, int fxSlot, int paramIndex) { return fxParamManager_->GetParamName(track, fxSlot, paramIndex); }
+    const string &GetFXParamFormattedValue(MediaTrack* track, int fxSlot, int paramIndex) { return fxParamManager_->GetFormattedParamValue(track, fxSlot, paramIndex); }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Page facade for FocusedFXManager
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int GetFocusedFXGeneration() { return focusedFXManager_->GetGeneration(); }
+    int GetFocusedFX(int &trackNumber, int &itemNumber, int &fxIndex) { return focusedFXManager_->GetFocusedFX(trackNumber, itemNumber, fxIndex); }
+    bool GetLastTouchedFX(int &trackNumber, int &fxSlot, int &fxParam) { return focusedFXManager_->GetLastTouchedFX(trackNumber, fxSlot, fxParam); }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Page facade for TrackRoutingManager
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int GetNumHardwareSends(MediaTrack* track) { return trackRoutingManager_->GetNumHardwareSends(track); }
+    int GetNumSends(MediaTrack* track) { return trackRoutingManager_->GetNumSends(track); }
+    int GetNumReceives(MediaTrack* track) { return trackRoutingManager_->GetNumReceives(track); }
+    MediaTrack* GetSendDestination(MediaTrack* track, int sendIndex) { return trackRoutingManager_->GetSendDestination(track, sendIndex); }
+    const string &GetSendDestinationName(MediaTrack* track, int sendIndex) { return trackRoutingManager_->GetSendDestinationName(track, sendIndex); }
+    MediaTrack* GetReceiveSource(MediaTrack* track, int receiveIndex) { return trackRoutingManager_->GetReceiveSource(track, receiveIndex); }
+    const string &GetReceiveSourceName(MediaTrack* track, int receiveIndex) { return trackRoutingManager_->GetReceiveSourceName(track, receiveIndex); }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Page facade for FeedbackScheduler
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void SetFeedbackBudget(double budget) { feedbackScheduler_->SetBudget(budget); }
+    void SetFeedbackRefreshRate(int feedbackClass, double rate) { feedbackScheduler_->SetRefreshRate(feedbackClass, rate); }
+    bool GetIsFeedbackRefreshDue(int feedbackClass) { return feedbackScheduler_->GetIsRefreshDue(feedbackClass); }
+    double GetFeedbackRefreshInterval(int feedbackClass) { return feedbackScheduler_->GetRefreshInterval(feedbackClass); }
+    int GetFeedbackCycle() { return feedbackScheduler_->GetCycle(); }
+    bool GetIsFeedbackOverBudget() { return feedbackScheduler_->GetIsOverBudget(); }
+    void RecordDeferredFeedback(int feedbackClass, int count, int newCount) { feedbackScheduler_->RecordDeferred(feedbackClass, count, newCount); }
+    void RecordFeedbackAge(int feedbackClass, int age) { feedbackScheduler_->RecordAge(feedbackClass, age); }
+    void LogFeedbackStaleness() { feedbackScheduler_->LogStaleness(name_); }
     
     
     /*
@@ -3080,6 +4315,10 @@ public:
 //*
     void Run()
     {
+        trackMeterManager_->BeginCycle();
+        focusedFXManager_->Poll();
+        trackRoutingManager_->BeginCycle();
+        
         trackNavigationManager_->RebuildTracks();
         trackNavigationManager_->RebuildVCASpill();
         trackNavigationManager_->RebuildFolderTracks();
@@ -3087,10 +4326,39 @@ public:
         for(auto surface : surfaces_)
             surface->HandleExternalInput();
         
+        UpdateHasInput();
+        
+        trackStateManager_->BeginCycle();
+        feedbackScheduler_->BeginCycle();
+        
+        // Every surface sends its High feedback while walking its Zones, lower classes wait until all of them have
         for(auto surface : surfaces_)
             surface->RequestUpdate();
+        
+        for(auto surface : surfaces_)
+            surface->FlushFeedback(true);
     }
 //*/
+    
+    // Between full cycles -- drain input and echo feedback to the Widgets it moved, nothing else
+    void RunInputCycle()
+    {
+        for(auto surface : surfaces_)
+            surface->HandleExternalInput();
+        
+        UpdateHasInput();
+        
+        if(! hasInput_)
+            return;
+        
+        trackStateManager_->BeginCycle();
+        
+        for(auto surface : surfaces_)
+            surface->RequestInputEchoUpdate();
+        
+        for(auto surface : surfaces_)
+            surface->FlushFeedback(false); // an echo is never held back
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3108,9 +4376,33 @@ private:
     bool surfaceOutDisplay_ = false;
     bool fxParamsDisplay_ = false;
     bool fxParamsWrite_ = false;
+    bool feedbackStalenessDisplay_ = false;
 
     bool shouldRun_ = true;
     
+    double lastFullRunTime_ = 0.0; // only the full cycle sets this, input-only cycles must not hold back the idle full cycle
+    
+    double idleQuietTime_ = 0.0; // ms with no input, transport or Reaper changes before throttling, 0 never throttles
+    double idleRunInterval_ = 0.0; // ms between full cycles while idle
+    double lastActivityTime_ = 0.0;
+    int projectStateChangeCount_ = -1;
+    
+    bool GetIsIdle(double now)
+    {
+        if(idleQuietTime_ <= 0.0)
+            return false;
+        
+        int projectStateChangeCount = DAW::GetProjectStateChangeCount();
+        
+        if(projectStateChangeCount != projectStateChangeCount_ || (DAW::GetPlayState() & 5) || pages_[currentPageIndex_]->GetIsTransportWinding())
+        {
+            projectStateChangeCount_ = projectStateChangeCount;
+            lastActivityTime_ = now;
+        }
+        
+        return now - lastActivityTime_ > idleQuietTime_;
+    }
+    
     int *timeModePtr_ = nullptr;
     int *timeMode2Ptr_ = nullptr;
     int *measOffsPtr_ = nullptr;
@@ -3196,6 +4488,8 @@ public:
     void ToggleSurfaceOutDisplay() { surfaceOutDisplay_ = ! surfaceOutDisplay_;  }
     void ToggleFXParamsDisplay() { fxParamsDisplay_ = ! fxParamsDisplay_;  }
     void ToggleFXParamsWrite() { fxParamsWrite_ = ! fxParamsWrite_;  }
+    void ToggleFeedbackStalenessDisplay() { feedbackStalenessDisplay_ = ! feedbackStalenessDisplay_;  }
+    void NoteActivity() { lastActivityTime_ = DAW::GetCurrentNumberOfMilliseconds(); }
 
     bool GetSurfaceInDisplay() { return surfaceInDisplay_;  }
     bool GetSurfaceRawInDisplay() { return surfaceRawInDisplay_;  }
@@ -3252,14 +4546,39 @@ public:
 
     void OnTrackSelection(MediaTrack *track)
     {
+        OnTrackSelectionChange(track);
+        
         if(pages_.size() > 0)
             pages_[currentPageIndex_]->OnTrackSelection(track);
     }
     
+    void OnTrackSelectionChange(MediaTrack *track)
+    {
+        NoteActivity();
+        
+        for(auto page : pages_)
+            page->OnTrackSelectionChange(track);
+    }
+    
+    void SetTrackIsDirty(MediaTrack* track)
+    {
+        NoteActivity();
+        
+        for(auto page : pages_)
+            page->SetTrackIsDirty(track);
+    }
+    
     void OnTrackListChange()
     {
-        if(pages_.size() > 0)
-            pages_[currentPageIndex_]->OnTrackListChange();
+        NoteActivity();
+        
+        for(int i = 0; i < (int)pages_.size(); i++)
+        {
+            if(i == currentPageIndex_)
+                pages_[i]->OnTrackListChange();
+            else
+                pages_[i]->ClearTrackCaches();
+        }
     }
     
     void NextTimeDisplayMode()
@@ -3353,6 +4672,8 @@ public:
     
     void TrackFXListChanged(MediaTrack* track)
     {
+        NoteActivity();
+        
         for(auto & page : pages_)
             page->TrackFXListChanged(track);
         
@@ -3421,7 +4742,32 @@ public:
         //int start = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
         
         if(shouldRun_ && pages_.size() > 0)
-            pages_[currentPageIndex_]->Run();
+        {
+            Page* page = pages_[currentPageIndex_];
+            
+            double now = DAW::GetCurrentNumberOfMilliseconds();
+            
+            // While idle only input is drained between the slow full cycles, so the first touch restores the full rate
+            if(GetIsIdle(now) && now - lastFullRunTime_ < idleRunInterval_)
+            {
+                page->RunInputCycle();
+                
+                if(! page->GetHasInput())
+                    return;
+                
+                lastActivityTime_ = now;
+            }
+            
+            page->Run();
+            
+            lastFullRunTime_ = now;
+            
+            if(page->GetHasInput())
+                lastActivityTime_ = now;
+            
+            if(feedbackStalenessDisplay_)
+                page->LogFeedbackStaleness();
+        }
         /*
          repeats++;
          
@@ -167,6 +167,8 @@ public:
     
     static int GetPlayState() { return ::GetPlayState(); }
     
+    static int GetProjectStateChangeCount() { return ::GetProjectStateChangeCount(NULL); }
+    
     static int CSurf_NumTracks(bool mcpView) { return ::CSurf_NumTracks(mcpView); };
     
     static MediaTrack* CSurf_TrackFromID(int idx, bool mcpView) { return ::CSurf_TrackFromID(idx, mcpView); }
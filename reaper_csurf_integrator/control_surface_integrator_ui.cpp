@@ -18,6 +18,7 @@ extern int g_registered_command_toggle_show_surface_input;
 extern int g_registered_command_toggle_show_surface_output;
 extern int g_registered_command_toggle_show_FX_params;
 extern int g_registered_command_toggle_write_FX_params;
+extern int g_registered_command_toggle_show_feedback_staleness;
 
 bool hookCommandProc(int command, int flag)
 {
@@ -48,6 +49,11 @@ bool hookCommandProc(int command, int flag)
             TheManager->ToggleFXParamsWrite();
             return true;
         }
+        else if (command == g_registered_command_toggle_show_feedback_staleness)
+        {
+            TheManager->ToggleFeedbackStalenessDisplay();
+            return true;
+        }
     }
     return false;
 }
@@ -82,6 +88,48 @@ void CSurfIntegrator::SetTrackListChange()
         TheManager->OnTrackListChange();
 }
 
+void CSurfIntegrator::SetSurfaceVolume(MediaTrack *trackid, double /* volume */)
+{
+    if(TheManager)
+        TheManager->SetTrackIsDirty(trackid);
+}
+
+void CSurfIntegrator::SetSurfacePan(MediaTrack *trackid, double /* pan */)
+{
+    if(TheManager)
+        TheManager->SetTrackIsDirty(trackid);
+}
+
+void CSurfIntegrator::SetSurfaceMute(MediaTrack *trackid, bool /* mute */)
+{
+    if(TheManager)
+        TheManager->SetTrackIsDirty(trackid);
+}
+
+void CSurfIntegrator::SetSurfaceSelected(MediaTrack *trackid, bool /* selected */)
+{
+    if(TheManager)
+        TheManager->OnTrackSelectionChange(trackid);
+}
+
+void CSurfIntegrator::SetSurfaceSolo(MediaTrack *trackid, bool /* solo */)
+{
+    if(TheManager)
+        TheManager->SetTrackIsDirty(trackid);
+}
+
+void CSurfIntegrator::SetSurfaceRecArm(MediaTrack *trackid, bool /* recarm */)
+{
+    if(TheManager)
+        TheManager->SetTrackIsDirty(trackid);
+}
+
+void CSurfIntegrator::SetTrackTitle(MediaTrack *trackid, const char * /* title */)
+{
+    if(TheManager)
+        TheManager->SetTrackIsDirty(trackid);
+}
+
 int CSurfIntegrator::Extended(int call, void *parm1, void *parm2, void *parm3)
 {
     if(call == CSURF_EXT_SUPPORTS_EXTENDED_TOUCH)
@@ -89,12 +137,22 @@ int CSurfIntegrator::Extended(int call, void *parm1, void *parm2, void *parm3)
         return 1;
     }
     
+    if(TheManager)
+        TheManager->NoteActivity();
+    
     if(call == CSURF_EXT_RESET)
     {
        if(TheManager)
            TheManager->Init();
     }
     
+    if(call == CSURF_EXT_SETPAN_EX || call == CSURF_EXT_SETINPUTMONITOR)
+    {
+        // parm1=(MediaTrack*)track
+        if(TheManager)
+            TheManager->SetTrackIsDirty((MediaTrack*)parm1);
+    }
+    
     if(call == CSURF_EXT_SETFXCHANGE)
     {
         // parm1=(MediaTrack*)track, whenever FX are added, deleted, or change order
@@ -223,6 +281,9 @@ static char zoneTemplateFolder[BUFSZ];
 
 static vector<shared_ptr<PageLine>> pages;
 
+// Global settings the dialog does not edit, written back as read so saving never drops them
+static vector<string> settingLines;
+
 void AddComboEntry(HWND hwndDlg, int x, char * buf, int comboId)
 {
     int a=SendDlgItemMessage(hwndDlg,comboId,CB_ADDSTRING,0,(LPARAM)buf);
@@ -977,6 +1038,7 @@ static WDL_DLGRET dlgProcMainConfig(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPAR
         {
             surfaces.clear();
             pages.clear();
+            settingLines.clear();
             
             ifstream iniFile(string(DAW::GetResourcePath()) + "/CSI/CSI.ini");
             
@@ -1059,6 +1121,10 @@ static WDL_DLGRET dlgProcMainConfig(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPAR
                         
                         AddListEntry(hwndDlg, page->name, IDC_LIST_Pages);
                     }
+                    else if(tokens[0] == MeterBallisticsToken || tokens[0] == FeedbackBudgetToken || tokens[0] == IdleThrottleToken || tokens[0] == RefreshRateToken)
+                    {
+                        settingLines.push_back(line);
+                    }
                     else if(tokens.size() == 5 || tokens.size() == 6)
                     {
                         bool useLocalModifiers = false;
@@ -1112,6 +1178,14 @@ static WDL_DLGRET dlgProcMainConfig(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPAR
                 
                 iniFile << GetLineEnding();
                 
+                if(settingLines.size() > 0)
+                {
+                    for(auto settingLine : settingLines)
+                        iniFile << settingLine + GetLineEnding();
+                    
+                    iniFile << GetLineEnding();
+                }
+                
                 string line = "";
                 
                 for(auto surface : surfaces)
@@ -23,6 +23,13 @@ public:
     CSurfIntegrator();
     ~CSurfIntegrator();
     virtual void SetTrackListChange() override;
+    virtual void SetSurfaceVolume(MediaTrack *trackid, double volume) override;
+    virtual void SetSurfacePan(MediaTrack *trackid, double pan) override;
+    virtual void SetSurfaceMute(MediaTrack *trackid, bool mute) override;
+    virtual void SetSurfaceSelected(MediaTrack *trackid, bool selected) override;
+    virtual void SetSurfaceSolo(MediaTrack *trackid, bool solo) override;
+    virtual void SetSurfaceRecArm(MediaTrack *trackid, bool recarm) override;
+    virtual void SetTrackTitle(MediaTrack *trackid, const char *title) override;
     virtual void OnTrackSelection(MediaTrack *trackid) override;
     virtual int Extended(int call, void *parm1, void *parm2, void *parm3) override;
     virtual bool GetTouchState(MediaTrack *trackid, int touchedControl) override;
@@ -132,7 +132,7 @@ public:
         if(DAW::IsProjectDirty())
             context->UpdateWidgetValue(1);
         else
-            context->UpdateWidgetValue(0);
+            context->UpdateWidgetValue(0.0);
     }
     
     void Do(ActionContext* context, double value) override
@@ -156,7 +156,7 @@ public:
         if(DAW::CanUndo())
             context->UpdateWidgetValue(1);
         else
-            context->UpdateWidgetValue(0);
+            context->UpdateWidgetValue(0.0);
     }
     
     void Do(ActionContext* context, double value) override
@@ -180,7 +180,7 @@ public:
         if(DAW::CanRedo())
             context->UpdateWidgetValue(1);
         else
-            context->UpdateWidgetValue(0);
+            context->UpdateWidgetValue(0.0);
     }
     
     void Do(ActionContext* context, double value) override
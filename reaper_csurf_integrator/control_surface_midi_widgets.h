@@ -405,8 +405,9 @@ public:
     TwoState_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1, MIDI_event_ex_t* feedback2) : Midi_FeedbackProcessor(surface, widget, feedback1, feedback2) { }
     
     virtual string GetName() override { return "TwoState_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassHigh; }
     
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(value == 0.0)
         {
@@ -419,7 +420,7 @@ public:
             SendMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1], midiFeedbackMessage1_->midi_message[2]);
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         if(value == 0.0)
         {
@@ -445,8 +446,9 @@ public:
     FPTwoStateRGB_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "FPTwoStateRGB_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassHigh; }
 
-    virtual void SetValue(map<string, string> &properties, double active) override
+    virtual void SetValue(WidgetProperties &properties, double active) override
     {
         active_ = active;
     }
@@ -486,6 +488,7 @@ public:
     NovationLaunchpadMiniRGB7Bit_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "NovationLaunchpadMiniRGB7Bit_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassHigh; }
 
     virtual void SetColorValue(rgba_color color) override
     {
@@ -534,6 +537,7 @@ public:
     FaderportRGB_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "FaderportRGB_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassHigh; }
     
     virtual void SetColorValue(rgba_color color) override
     {
@@ -561,14 +565,15 @@ public:
     Fader14Bit_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "Fader14Bit_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassHigh; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         int volint = value * 16383.0;
         SendMidiMessage(midiFeedbackMessage1_->midi_message[0], volint&0x7f, (volint>>7)&0x7f);
     }
     
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         int volint = value * 16383.0;
         ForceMidiMessage(midiFeedbackMessage1_->midi_message[0], volint&0x7f, (volint>>7)&0x7f);
@@ -584,13 +589,14 @@ public:
     Fader7Bit_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "Fader7Bit_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassHigh; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         SendMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1], value * 127.0);
     }
     
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         ForceMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1], value * 127.0);
     }
@@ -605,34 +611,23 @@ public:
     Encoder_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "Encoder_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassHigh; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         SendMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1] + 0x20, GetMidiValue(properties, value));
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         ForceMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1] + 0x20, GetMidiValue(properties, value));
     }
     
-    int GetMidiValue(map<string, string> &properties, double value)
+    int GetMidiValue(WidgetProperties &properties, double value)
     {
         int valueInt = value * 127;
         
-        int displayMode = 0;
-        
-        if(properties.count("RingStyle") > 0)
-        {
-            if(properties["RingStyle"] == "Dot")
-                displayMode = 0;
-            else if(properties["RingStyle"] == "BoostCut")
-                displayMode = 1;
-            else if(properties["RingStyle"] == "Fill")
-                displayMode = 2;
-            else if(properties["RingStyle"] == "Spread")
-                displayMode = 3;
-        }
+        int displayMode = properties.ringStyle;
 
         int val = 0;
         
@@ -657,13 +652,14 @@ public:
     ConsoleOneVUMeter_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "ConsoleOneVUMeter_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         SendMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1], GetMidiValue(value));
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         ForceMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1], GetMidiValue(value));
     }
@@ -696,13 +692,14 @@ public:
     ConsoleOneGainReductionMeter_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, MIDI_event_ex_t* feedback1) : Midi_FeedbackProcessor(surface, widget, feedback1) { }
     
     virtual string GetName() override { return "ConsoleOneGainReductionMeter_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         SendMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1], fabs(1.0 - value) * 127.0);
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         ForceMidiMessage(midiFeedbackMessage1_->midi_message[0], midiFeedbackMessage1_->midi_message[1], fabs(1.0 - value) * 127.0);
     }
@@ -722,8 +719,9 @@ public:
     QConProXMasterVUMeter_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int param) : Midi_FeedbackProcessor(surface, widget), param_(param) { }
     
     virtual string GetName() override { return "QConProXMasterVUMeter_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         //Master Channel:
         //Master Level 1 : 0xd1, 0x0L
@@ -740,7 +738,7 @@ public:
         SendMidiMessage(0xd1, (param_ << 4) | midiValue, 0);
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         //Master Channel:
         //Master Level 1 : 0xd1, 0x0L
@@ -773,13 +771,14 @@ public:
     MCUVUMeter_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int displayType, int channelNumber) : Midi_FeedbackProcessor(surface, widget), displayType_(displayType), channelNumber_(channelNumber) {}
     
     virtual string GetName() override { return "MCUVUMeter_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         SendMidiMessage(0xd0, (channelNumber_ << 4) | GetMidiValue(value), 0);
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         ForceMidiMessage(0xd0, (channelNumber_ << 4) | GetMidiValue(value), 0);
     }
@@ -809,8 +808,9 @@ public:
     FPVUMeter_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int channelNumber) : Midi_FeedbackProcessor(surface, widget), channelNumber_(channelNumber) {}
     
     virtual string GetName() override { return "FPVUMeter_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassMeter; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(lastMidiValue_ == value || GetMidiValue(value) < 7)
         {
@@ -825,7 +825,7 @@ public:
         }
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         lastMidiValue_ = value;
         if(channelNumber_ < 8)
@@ -853,23 +853,10 @@ private:
     double lastValue_ = 0;
     int channel_ = 0;
     
-    int GetValueBarType(map<string, string> &properties)
+    int GetValueBarType(WidgetProperties &properties)
     {
         // 0: Normal, 1: Bipolar, 2: Fill, 3: Spread, 4: Off
-
-        if(properties.count("BarStyle") > 0)
-        {
-            if(properties["BarStyle"] == "Normal")
-                return 0;
-            else if(properties["BarStyle"] == "BiPolar")
-                return 1;
-            else if(properties["BarStyle"] == "Fill")
-                return 2;
-            else if(properties["BarStyle"] == "Spread")
-                return 3;
-        }
-
-        return 4;
+        return properties.barStyle;
     }
     
 public:
@@ -878,7 +865,7 @@ public:
 
     virtual string GetName() override { return "FPValueBar_Midi_FeedbackProcessor"; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(value == lastValue_)
             return;
@@ -886,7 +873,7 @@ public:
         ForceValue(properties, value);
     }
 
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         lastValue_ = value;
         
@@ -919,14 +906,15 @@ public:
     MCUDisplay_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int displayUpperLower, int displayType, int displayRow, int channel) : Midi_FeedbackProcessor(surface, widget), offset_(displayUpperLower * 56), displayType_(displayType), displayRow_(displayRow), channel_(channel) { }
     
     virtual string GetName() override { return "MCUDisplay_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
-    virtual void SetValue(map<string, string> &properties, string displayText) override
+    virtual void SetValue(WidgetProperties &properties, const string &displayText) override
     {
         if(displayText != lastStringSent_) // changes since last send
             ForceValue(properties, displayText);
     }
 
-    virtual void ForceValue(map<string, string> &properties, string displayText) override
+    virtual void ForceValue(WidgetProperties &properties, string displayText) override
     {
         lastStringSent_ = displayText;
         
@@ -985,7 +973,6 @@ private:
     int channel_ = 0;
     int preventUpdateTrackColors_ = false;
     string lastStringSent_ = "";
-    vector<rgba_color> currentTrackColors_;
     map<string, int> availableColors =
     {
         { "Black", 0 },
@@ -1002,15 +989,11 @@ public:
     virtual ~XTouchDisplay_Midi_FeedbackProcessor() {}
     XTouchDisplay_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int displayUpperLower, int displayType, int displayRow, int channel) : Midi_FeedbackProcessor(surface, widget), offset_(displayUpperLower * 56), displayType_(displayType), displayRow_(displayRow), channel_(channel)
     {
-        rgba_color color;
-        
-        for(int i = 0; i < surface_->GetNumChannels(); i++)
-            currentTrackColors_.push_back(color);
-        
         surface_->AddTrackColorFeedbackProcessor(this);
     }
         
     virtual string GetName() override { return "XTouchDisplay_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void SetXTouchDisplayColors(string colors) override
     {
@@ -1054,13 +1037,15 @@ public:
         preventUpdateTrackColors_ = false;
     }
     
-    virtual void SetValue(map<string, string> &properties, string displayText) override
+    virtual bool GetCanUpdateTrackColors() override { return ! preventUpdateTrackColors_; }
+    
+    virtual void SetValue(WidgetProperties &properties, const string &displayText) override
     {
         if(displayText != lastStringSent_) // changes since last send
             ForceValue(properties, displayText);
     }
 
-    virtual void ForceValue(map<string, string> &properties, string displayText) override
+    virtual void ForceValue(WidgetProperties &properties, string displayText) override
     {
         lastStringSent_ = displayText;
         
@@ -1109,28 +1094,6 @@ public:
         ForceUpdateTrackColors();
     }
 
-    virtual void UpdateTrackColors() override
-    {
-        bool shouldUpdate = false;
-               
-        for(int i = 0; i < surface_->GetNumChannels(); i++)
-        {
-            if(MediaTrack* track = surface_->GetPage()->GetNavigatorForChannel(i + surface_->GetChannelOffset())->GetTrack())
-            {
-                rgba_color color = DAW::GetTrackColor(track);
-                
-                if(color != currentTrackColors_[i])
-                {
-                    shouldUpdate = true;
-                    break;
-                }
-            }
-        }
-        
-        if(shouldUpdate)
-            ForceUpdateTrackColors();
-    }
-    
     virtual void ForceUpdateTrackColors() override
     {
         if(preventUpdateTrackColors_)
@@ -1158,11 +1121,9 @@ public:
             }
             else
             {
-                if(MediaTrack* track = surface_->GetPage()->GetNavigatorForChannel(i + surface_->GetChannelOffset())->GetTrack())
+                if(surface_->GetChannelTrack(i) != nullptr)
                 {
-                    rgba_color color = DAW::GetTrackColor(track);
-                    
-                    currentTrackColors_[i] = color;
+                    rgba_color color = surface_->GetChannelTrackColor(i);
                     
                     int r = color.r;
                     int g = color.g;
@@ -1209,25 +1170,16 @@ private:
     int channel_ = 0;
     string lastStringSent_ = " ";
     
-    int GetTextAlign(map<string, string> &properties)
+    int GetTextAlign(WidgetProperties &properties)
     {
         // Center: 0, Left: 1, Right: 2
-        if(properties.count("TextAlign") > 0)
-        {
-            if(properties["TextAlign"] == "Left")
-                return 1;
-            else if(properties["TextAlign"] == "Right")
-                return 2;
-        }
-
-        return 0;
+        return properties.textAlign;
     }
     
-    int GetTextInvert(map<string, string> &properties)
+    int GetTextInvert(WidgetProperties &properties)
     {
-        if(properties.count("TextInvert") > 0)
-            if(properties["TextInvert"] == "Yes")
-                return 4;
+        if(properties.textInvert)
+            return 4;
 
         return 0;
     }
@@ -1237,13 +1189,14 @@ public:
     FPDisplay_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int displayType, int channel, int displayRow) : Midi_FeedbackProcessor(surface, widget), displayType_(displayType), channel_(channel), displayRow_(displayRow) { }
     
     virtual string GetName() override { return "FPDisplay_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void ClearCache() override
     {
         lastStringSent_ = " ";
     }
     
-    virtual void SetValue(map<string, string> &properties, string displayText) override
+    virtual void SetValue(WidgetProperties &properties, const string &displayText) override
     {
         if(displayText == lastStringSent_) // changes since last send
             return;
@@ -1251,7 +1204,7 @@ public:
         ForceValue(properties, displayText);
     }
     
-    virtual void ForceValue(map<string, string> &properties, string displayText) override
+    virtual void ForceValue(WidgetProperties &properties, string displayText) override
     {
         lastStringSent_ = displayText;
         
@@ -1313,12 +1266,9 @@ private:
     int channel_ = 0;
     int lastMode_ = 0;
 
-    int GetMode(map<string, string> &properties)
+    int GetMode(WidgetProperties &properties)
     {
-        int param = 2;
-
-        if(properties.count("Mode") > 0)
-            param = stoi(properties["Mode"]);
+        int param = properties.mode;
 
         if (param >= 0 && param < 9)
             return param;
@@ -1332,7 +1282,7 @@ public:
     
     virtual string GetName() override { return "FPScribbleStripMode_Midi_FeedbackProcessor"; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(lastMode_ == GetMode(properties))
             return;
@@ -1340,7 +1290,7 @@ public:
         ForceValue(properties, value);
     }
     
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         lastMode_ = GetMode(properties);
         
@@ -1383,19 +1333,20 @@ public:
     QConLiteDisplay_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int displayUpperLower, int displayType, int displayRow, int channel) : Midi_FeedbackProcessor(surface, widget), offset_(displayUpperLower * 28), displayType_(displayType), displayRow_(displayRow), channel_(channel) { }
     
     virtual string GetName() override { return "QConLiteDisplay_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual void ClearCache() override
     {
         lastStringSent_ = " ";
     }
     
-    virtual void SetValue(map<string, string> &properties, string displayText) override
+    virtual void SetValue(WidgetProperties &properties, const string &displayText) override
     {
         if(displayText != lastStringSent_) // changes since last send
             ForceValue(properties, displayText);
     }
     
-    virtual void ForceValue(map<string, string> &properties, string displayText) override
+    virtual void ForceValue(WidgetProperties &properties, string displayText) override
     {
         lastStringSent_ = displayText;
         
@@ -1648,6 +1599,7 @@ public:
     SCE24_Text_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget, int cellNumber, int itemNumber) : SCE24_Midi_FeedbackProcessor(surface, widget, cellNumber, itemNumber) { }
  
     virtual string GetName() override { return "SCE24_Text_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
     virtual int GetMaxCharacters() override
     {
@@ -1659,13 +1611,13 @@ public:
         lastStringValue_ = " ";
     }
     
-    virtual void SetValue(map<string, string> &properties, string displayText) override
+    virtual void SetValue(WidgetProperties &properties, const string &displayText) override
     {
         if(displayText != lastStringValue_) // changes since last send
             ForceValue(properties, displayText);
     }
     
-    virtual void ForceValue(map<string, string> &properties, string value) override
+    virtual void ForceValue(WidgetProperties &properties, string value) override
     {
         lastStringValue_ = value;
         text_ = value;
@@ -1750,7 +1702,7 @@ public:
         lastDoubleValue_ = 0.0;
     }
     
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(int(value * 100.00) != (int)lastDoubleValue_) // changes since last send
         {
@@ -1759,7 +1711,7 @@ public:
         }
     }
     
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         struct
         {
@@ -1806,7 +1758,7 @@ public:
         lastDoubleValue_ = 0.0;
     }
     
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(int(value * 100.00) != (int)lastDoubleValue_) // changes since last send
         {
@@ -1815,7 +1767,7 @@ public:
         }
     }
     
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         struct
         {
@@ -1863,26 +1815,26 @@ public:
         return maxChars.GetMaxCharacters(displayType_);
     }
     
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(value != lastDoubleValue_) // changes since last send
             ForceValue(properties, value);
     }
     
-    void ForceValue(map<string, string> &properties, double value) override
+    void ForceValue(WidgetProperties &properties, double value) override
     {
         lastDoubleValue_ = value;
         SetCurrentColor(value); // This will cause a Force()
     }
     
-    virtual void SetValue(map<string, string> &properties, string value) override
+    virtual void SetValue(WidgetProperties &properties, const string &value) override
     {
         if(value != lastStringValue_) // changes since last send
             ForceValue(properties, value);
     }
 
 
-    void ForceValue(map<string, string> &properties, string value) override
+    void ForceValue(WidgetProperties &properties, string value) override
     {
         lastStringValue_ = value;
         text_ = value;
@@ -1959,13 +1911,13 @@ public:
         lastDoubleValue_ = 0.0;
     }
     
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(value != lastDoubleValue_) // changes since last send
             ForceValue(properties, value);
     }
        
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         
         lastDoubleValue_ = value;
@@ -2016,13 +1968,13 @@ public:
         lastDoubleValue_ = 0.0;
     }
     
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(value != lastDoubleValue_) // changes since last send
             ForceValue(properties, value);
     }
         
-    virtual void ForceValue(map<string, string> &properties, double value) override
+    virtual void ForceValue(WidgetProperties &properties, double value) override
     {
         lastDoubleValue_ = value;
         SetCurrentColor(value);
@@ -2068,8 +2020,9 @@ public:
     FB_MCU_AssignmentDisplay_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget) : Midi_FeedbackProcessor(surface, widget) {}
     
     virtual string GetName() override { return "FB_MCU_AssignmentDisplay_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassDisplay; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         if(value == 0.0) // Selected Track
         {
@@ -2105,8 +2058,9 @@ public:
     MCU_TimeDisplay_Midi_FeedbackProcessor(Midi_ControlSurface* surface, Widget* widget) : Midi_FeedbackProcessor(surface, widget) {}
     
     virtual string GetName() override { return "MCU_TimeDisplay_Midi_FeedbackProcessor"; }
+    virtual int GetFeedbackClass() override { return FeedbackClassTime; }
 
-    virtual void SetValue(map<string, string> &properties, double value) override
+    virtual void SetValue(WidgetProperties &properties, double value) override
     {
         
 #ifndef timeGetTime
@@ -44,6 +44,14 @@ gaccel_register_t acreg_write_FX_params =
 
 int g_registered_command_toggle_write_FX_params = 0;
 
+gaccel_register_t acreg_show_feedback_staleness =
+{
+    {FCONTROL|FALT|FVIRTKEY, '5', 0},
+    "CSI Toggle Show Feedback Staleness"
+};
+
+int g_registered_command_toggle_show_feedback_staleness = 0;
+
 
 extern bool hookCommandProc(int command, int flag);
 
@@ -121,6 +129,13 @@ REAPER_PLUGIN_DLL_EXPORT int REAPER_PLUGIN_ENTRYPOINT(REAPER_PLUGIN_HINSTANCE hI
         
         reaper_plugin_info->Register("gaccel", &acreg_write_FX_params);
         
+        acreg_show_feedback_staleness.accel.cmd = g_registered_command_toggle_show_feedback_staleness = reaper_plugin_info->Register("command_id", (void*)"CSI Toggle Show Feedback Staleness");
+        
+        if (!g_registered_command_toggle_show_feedback_staleness)
+            return 0; // failed getting a command id, fail!
+        
+        reaper_plugin_info->Register("gaccel", &acreg_show_feedback_staleness);
+        
 
         reaper_plugin_info->Register("hookcommand", (void*)hookCommandProc);
         
@@ -0,0 +1,397 @@
+//
+//  steady_state_allocations.cpp
+//  reaper_csurf_integrator
+//
+//  Runs the Manager against a stand-in DAW and fails if a steady state Run cycle allocates.
+//
+//  From reaper_csurf_integrator:
+//      g++ -std=c++17 -O1 -DSWELL_PROVIDED_BY_APP -I. control_surface_integrator.cpp tests/steady_state_allocations.cpp -o steady_state_allocations && ./steady_state_allocations
+//
+
+#include <atomic>
+#include <new>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <unordered_set>
+#include <unordered_map>
+#include <iomanip>
+#include <fstream>
+#include <regex>
+#include <cmath>
+#include <memory>
+#include <filesystem>
+#include <chrono>
+#include <bitset>
+#include <functional>
+
+#include "WDL/swell/swell-modstub-generic.cpp" // defines the SWELL function pointers, must come before anything else includes swell.h
+
+#define REAPERAPI_IMPLEMENT
+#include "control_surface_integrator.h"
+
+HWND g_hwnd = nullptr;
+Manager* TheManager = nullptr;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Allocation counter
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static atomic<bool> isCounting(false);
+static atomic<int> allocationCount(0);
+
+void* operator new(size_t size)
+{
+    if(isCounting)
+        allocationCount++;
+
+    if(void* ptr = malloc(size ? size : 1))
+        return ptr;
+
+    throw bad_alloc();
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Stand-in DAW
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static const int NumTracks = 16;
+
+struct StandInTrack
+{
+    char name[64];
+    double volume = 0.5;
+    double pan = 0.0;
+};
+
+static StandInTrack tracks[NumTracks + 1]; // 0 is the master
+static string resourcePath;
+static DWORD now = 0;
+static double playPosition = 0.0;
+static int cycle = 0;
+
+static MediaTrack* ToTrack(int index) { return (MediaTrack*)&tracks[index]; }
+static int ToIndex(MediaTrack* track) { return track ? (int)((StandInTrack*)track - tracks) : -1; }
+
+static DWORD StandIn_GetTickCount() { return now; }
+static int StandIn_MessageBox(HWND, const char* text, const char* caption, int) { printf("%s: %s\n", caption, text); return 0; }
+static const char* StandIn_GetResourcePath() { return resourcePath.c_str(); }
+static void StandIn_ShowConsoleMsg(const char* msg) { printf("%s", msg); }
+static int StandIn_CSurf_NumTracks(bool) { return NumTracks; }
+static MediaTrack* StandIn_CSurf_TrackFromID(int index, bool) { return index >= 0 && index <= NumTracks ? ToTrack(index) : nullptr; }
+static int StandIn_CSurf_TrackToID(MediaTrack* track, bool) { return ToIndex(track); }
+static MediaTrack* StandIn_GetTrack(ReaProject*, int index) { return index >= 0 && index < NumTracks ? ToTrack(index + 1) : nullptr; }
+static MediaTrack* StandIn_GetMasterTrack(ReaProject*) { return ToTrack(0); }
+static int selectedTrack = 1;
+static int StandIn_CountSelectedTracks2(ReaProject*, bool) { return 1; }
+static MediaTrack* StandIn_GetSelectedTrack(ReaProject*, int index) { return index == 0 ? ToTrack(selectedTrack) : nullptr; }
+static bool StandIn_IsTrackVisible(MediaTrack*, bool) { return true; }
+static bool StandIn_ValidatePtr(void*, const char*) { return true; }
+
+static double StandIn_GetMediaTrackInfo_Value(MediaTrack* track, const char* parmname)
+{
+    if(! strcmp(parmname, "IP_TRACKNUMBER"))
+        return ToIndex(track) == 0 ? -1 : ToIndex(track);
+    else if(! strcmp(parmname, "I_SELECTED"))
+        return ToIndex(track) == selectedTrack;
+    else if(! strcmp(parmname, "D_VOL"))
+        return ((StandInTrack*)track)->volume;
+    else if(! strcmp(parmname, "D_PAN"))
+        return ((StandInTrack*)track)->pan;
+    else if(! strcmp(parmname, "I_CUSTOMCOLOR"))
+        return 0x1000000 | ToIndex(track) * 0x10101;
+    else if(! strcmp(parmname, "I_NCHAN"))
+        return 2;
+
+    return 0.0;
+}
+
+static void* StandIn_GetSetMediaTrackInfo(MediaTrack* track, const char* parmname, void*)
+{
+    if(! strcmp(parmname, "P_NAME"))
+        return ((StandInTrack*)track)->name;
+
+    return nullptr;
+}
+
+static bool StandIn_GetTrackName(MediaTrack* track, char* buf, int buf_sz)
+{
+    snprintf(buf, buf_sz, "%s", ((StandInTrack*)track)->name);
+    return true;
+}
+
+static bool StandIn_GetTrackUIVolPan(MediaTrack* track, double* volume, double* pan)
+{
+    *volume = ((StandInTrack*)track)->volume;
+    *pan = ((StandInTrack*)track)->pan;
+    return true;
+}
+
+static bool StandIn_GetTrackUIPan(MediaTrack* track, double* pan1, double* pan2, int* panMode)
+{
+    *pan1 = ((StandInTrack*)track)->pan;
+    *pan2 = 0.0;
+    *panMode = 0;
+    return true;
+}
+
+static bool StandIn_GetTrackUIMute(MediaTrack*, bool* mute) { *mute = false; return true; }
+
+// Meters move every cycle, like a playing project
+static double StandIn_Track_GetPeakInfo(MediaTrack* track, int channel) { return 0.25 + 0.25 * ((cycle + ToIndex(track) + channel) % 4); }
+
+static int StandIn_GetPlayState() { return 1; }
+// Every track sends to the next one, the last one to the first
+static int StandIn_GetTrackNumSends(MediaTrack*, int category) { return category == 0 ? 1 : 0; }
+static void* StandIn_GetSetTrackSendInfo(MediaTrack* track, int category, int, const char* parmname, void*)
+{
+    if(category == 0 && ! strcmp(parmname, "P_DESTTRACK"))
+        return ToTrack(ToIndex(track) % NumTracks + 1);
+
+    return nullptr;
+}
+
+static double StandIn_GetPlayPosition() { return playPosition; }
+static double StandIn_GetCursorPosition() { return playPosition; }
+static double StandIn_TimeMap2_timeToBeats(ReaProject*, double time, int* measures, int* cml, double* fullBeats, int* cdenom)
+{
+    if(measures) *measures = (int)(time / 2.0);
+    if(cml) *cml = 4;
+    if(fullBeats) *fullBeats = time * 2.0;
+    if(cdenom) *cdenom = 4;
+    return fmod(time * 2.0, 4.0);
+}
+
+static int StandIn_GetProjExtState(ReaProject*, const char*, const char*, char* buf, int) { buf[0] = 0; return 0; }
+static int projectStateChangeCount = 0;
+static int StandIn_GetProjectStateChangeCount(ReaProject*) { return projectStateChangeCount; }
+static int StandIn_ColorToNative(int r, int g, int b) { return r | g << 8 | b << 16; }
+static void StandIn_ColorFromNative(int color, int* r, int* g, int* b) { *r = color & 0xff; *g = (color >> 8) & 0xff; *b = (color >> 16) & 0xff; }
+
+static int configVars[64];
+static int StandIn_projectconfig_var_getoffs(const char*, int* size) { *size = sizeof(int); return 1; }
+static void* StandIn_projectconfig_var_addr(ReaProject*, int) { return configVars; }
+static void* StandIn_get_config_var(const char*, int* size) { *size = sizeof(double); return configVars; }
+static const char* StandIn_get_ini_file() { return ""; }
+
+// Counts what the surface is sent, proves the measured cycles really produce feedback
+class StandInMidiOutput : public midi_Output
+{
+public:
+    int numMessages = 0;
+    int numSysExMessages = 0;
+
+    virtual void SendMsg(MIDI_event_t *msg, int frame_offset) override { numSysExMessages++; }
+    virtual void Send(unsigned char status, unsigned char d1, unsigned char d2, int frame_offset) override { numMessages++; }
+};
+
+static StandInMidiOutput midiOutput;
+static midi_Output* StandIn_CreateMIDIOutput(int, bool, int*) { return &midiOutput; }
+
+static int StandIn_Zero() { return 0; }
+
+static void* GetStandInFunction(const char* name)
+{
+    static const map<string, void*> functions =
+    {
+        { "GetTickCount",                   (void*)StandIn_GetTickCount },
+        { "MessageBox",                     (void*)StandIn_MessageBox },
+        { "GetResourcePath",                (void*)StandIn_GetResourcePath },
+        { "ShowConsoleMsg",                 (void*)StandIn_ShowConsoleMsg },
+        { "CSurf_NumTracks",                (void*)StandIn_CSurf_NumTracks },
+        { "CSurf_TrackFromID",              (void*)StandIn_CSurf_TrackFromID },
+        { "CSurf_TrackToID",                (void*)StandIn_CSurf_TrackToID },
+        { "GetTrack",                       (void*)StandIn_GetTrack },
+        { "GetMasterTrack",                 (void*)StandIn_GetMasterTrack },
+        { "CountSelectedTracks2",           (void*)StandIn_CountSelectedTracks2 },
+        { "GetSelectedTrack",               (void*)StandIn_GetSelectedTrack },
+        { "IsTrackVisible",                 (void*)StandIn_IsTrackVisible },
+        { "ValidatePtr",                    (void*)StandIn_ValidatePtr },
+        { "GetMediaTrackInfo_Value",        (void*)StandIn_GetMediaTrackInfo_Value },
+        { "GetSetMediaTrackInfo",           (void*)StandIn_GetSetMediaTrackInfo },
+        { "GetTrackName",                   (void*)StandIn_GetTrackName },
+        { "GetTrackUIVolPan",               (void*)StandIn_GetTrackUIVolPan },
+        { "GetTrackUIPan",                  (void*)StandIn_GetTrackUIPan },
+        { "GetTrackUIMute",                 (void*)StandIn_GetTrackUIMute },
+        { "Track_GetPeakInfo",              (void*)StandIn_Track_GetPeakInfo },
+        { "GetPlayState",                   (void*)StandIn_GetPlayState },
+        { "GetPlayPosition",                (void*)StandIn_GetPlayPosition },
+        { "GetCursorPosition",              (void*)StandIn_GetCursorPosition },
+        { "TimeMap2_timeToBeats",           (void*)StandIn_TimeMap2_timeToBeats },
+        { "GetProjExtState",                (void*)StandIn_GetProjExtState },
+        { "GetProjectStateChangeCount",     (void*)StandIn_GetProjectStateChangeCount },
+        { "ColorToNative",                  (void*)StandIn_ColorToNative },
+        { "ColorFromNative",                (void*)StandIn_ColorFromNative },
+        { "projectconfig_var_getoffs",      (void*)StandIn_projectconfig_var_getoffs },
+        { "projectconfig_var_addr",         (void*)StandIn_projectconfig_var_addr },
+        { "get_config_var",                 (void*)StandIn_get_config_var },
+        { "get_ini_file",                   (void*)StandIn_get_ini_file },
+        { "CreateMIDIOutput",               (void*)StandIn_CreateMIDIOutput },
+        { "GetTrackNumSends",               (void*)StandIn_GetTrackNumSends },
+        { "GetSetTrackSendInfo",            (void*)StandIn_GetSetTrackSendInfo },
+    };
+
+    auto it = functions.find(name);
+
+    // Everything else answers 0 / false / nullptr, no MIDI devices, no sends, no FX
+    return it != functions.end() ? it->second : (void*)StandIn_Zero;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Stand-in CSI installation, an MCU style surface with meters, displays, faders and buttons
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void WriteFile(const filesystem::path &path, const string &contents)
+{
+    filesystem::create_directories(path.parent_path());
+    ofstream file(path);
+    file << contents;
+}
+
+static void WriteInstallation()
+{
+    filesystem::path root = filesystem::temp_directory_path() / "csi_steady_state_allocations";
+    filesystem::remove_all(root);
+    resourcePath = root.string();
+
+    WriteFile(root / "CSI" / "CSI.ini",
+              VersionToken + "\n"
+              "\n"
+              "MeterBallistics 20 1000\n"
+              "\n"
+              "MidiSurface \"MCU\" 0 0\n"
+              "\n"
+              "Page \"HomePage\"\n"
+              "\"MCU\" 8 0 \"MCU.mst\" \"MCU\"\n");
+
+    string mst;
+
+    for(int i = 1; i <= 8; i++)
+    {
+        char buf[1024];
+        snprintf(buf, sizeof(buf),
+                 "Widget DisplayUpper%d\n\tFB_XTouchDisplayUpper %d\nWidgetEnd\n"
+                 "Widget DisplayLower%d\n\tFB_MCUDisplayLower %d\nWidgetEnd\n"
+                 "Widget SendName%d\n\tFB_C4DisplayUpper 0 %d\nWidgetEnd\n"
+                 "Widget VUMeter%d\n\tFB_MCUVUMeter %d\nWidgetEnd\n"
+                 "Widget Fader%d\n\tFader14Bit e%x 7f 7f\n\tFB_Fader14Bit e%x 7f 7f\nWidgetEnd\n"
+                 "Widget Rotary%d\n\tEncoder b0 %x 7f\n\tFB_Encoder b0 %x 7f\nWidgetEnd\n"
+                 "Widget Mute%d\n\tPress 90 %x 7f 90 %x 00\n\tFB_TwoState 90 %x 7f 90 %x 00\nWidgetEnd\n"
+                 "Widget Solo%d\n\tPress 90 %x 7f 90 %x 00\n\tFB_TwoState 90 %x 7f 90 %x 00\nWidgetEnd\n"
+                 "Widget Select%d\n\tPress 90 %x 7f 90 %x 00\n\tFB_TwoState 90 %x 7f 90 %x 00\nWidgetEnd\n",
+                 i, i - 1,
+                 i, i - 1,
+                 i, i - 1,
+                 i, i - 1,
+                 i, i - 1, i - 1,
+                 i, 0x10 + i - 1, 0x30 + i - 1,
+                 i, 0x10 + i - 1, 0x10 + i - 1, 0x10 + i - 1, 0x10 + i - 1,
+                 i, 0x08 + i - 1, 0x08 + i - 1, 0x08 + i - 1, 0x08 + i - 1,
+                 i, 0x18 + i - 1, 0x18 + i - 1, 0x18 + i - 1, 0x18 + i - 1);
+        mst += buf;
+    }
+
+    mst += "Widget TimeDisplay\n\tFB_MCUTimeDisplay\nWidgetEnd\n"
+           "Widget Play\n\tPress 90 5e 7f 90 5e 00\n\tFB_TwoState 90 5e 7f 90 5e 00\nWidgetEnd\n"
+           "Widget Stop\n\tPress 90 5d 7f 90 5d 00\n\tFB_TwoState 90 5d 7f 90 5d 00\nWidgetEnd\n";
+
+    WriteFile(root / "CSI" / "Surfaces" / "Midi" / "MCU.mst", mst);
+
+    WriteFile(root / "CSI" / "Zones" / "MCU" / "Home.zon",
+              "Zone \"Home\"\n"
+              "\tIncludedZones\n"
+              "\t\t\"Track\"\n"
+              "\tIncludedZonesEnd\n"
+              "\tTimeDisplay TimeDisplay\n"
+              "\tPlay Play\n"
+              "\tStop Stop\n"
+              "ZoneEnd\n");
+
+    WriteFile(root / "CSI" / "Zones" / "MCU" / "Track.zon",
+              "Zone \"Track\"\n"
+              "\tDisplayUpper| TrackNameDisplay\n"
+              "\tDisplayLower| TrackVolumeDisplay\n"
+              "\tSendName| TrackSendNameDisplay\n"
+              "\tVUMeter| TrackOutputMeterMaxPeakLR\n"
+              "\tFader| TrackVolume\n"
+              "\tRotary| TrackPan \"0\"\n"
+              "\tMute| TrackMute\n"
+              "\tSolo| TrackSolo\n"
+              "\tSelect| TrackUniqueSelect\n"
+              "ZoneEnd\n");
+}
+
+int main()
+{
+    if(REAPERAPI_LoadAPI(GetStandInFunction) != 0 || doinit(GetStandInFunction) != 0)
+        return 1;
+
+    for(int i = 0; i <= NumTracks; i++)
+        snprintf(tracks[i].name, sizeof(tracks[i].name), i == 0 ? "MASTER" : "Stand-in track number %d", i);
+
+    WriteInstallation();
+
+    TheManager = new Manager();
+    TheManager->Init();
+
+    auto runCycles = [](int count)
+    {
+        for(int i = 0; i < count; i++)
+        {
+            cycle++;
+            now += 33;
+            playPosition += 0.033;
+
+            // Volume automation on every other track keeps the faders and value displays busy, Reaper reports each move
+            for(int track = 1; track <= NumTracks; track += 2)
+            {
+                tracks[track].volume = 0.5 + 0.25 * sin(cycle * 0.1 + track);
+                TheManager->SetTrackIsDirty(ToTrack(track));
+            }
+
+            // Someone clicking around the mixer, selecting tracks and making undoable edits
+            if(cycle % 25 == 0)
+            {
+                selectedTrack = selectedTrack % NumTracks + 1;
+                TheManager->OnTrackSelectionChange(ToTrack(selectedTrack));
+            }
+
+            if(cycle % 50 == 0)
+                projectStateChangeCount++;
+
+            TheManager->Run();
+        }
+    };
+
+    // Let the caches, pools and feedback batches reach their working size
+    runCycles(200);
+
+    const int numCycles = 1000;
+
+    midiOutput.numMessages = 0;
+    midiOutput.numSysExMessages = 0;
+
+    allocationCount = 0;
+    isCounting = true;
+    runCycles(numCycles);
+    isCounting = false;
+
+    printf("%d allocations over %d steady state cycles, %d MIDI and %d SysEx messages sent\n", (int)allocationCount, numCycles, midiOutput.numMessages, midiOutput.numSysExMessages);
+
+    if(midiOutput.numMessages == 0)
+    {
+        printf("FAILED, the stand-in surface received no feedback\n");
+        return 1;
+    }
+
+    if(allocationCount != 0)
+    {
+        printf("FAILED, steady state cycles must not allocate\n");
+        return 1;
+    }
+
+    return 0;
+}